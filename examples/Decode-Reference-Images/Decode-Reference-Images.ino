@@ -0,0 +1,103 @@
+#include <SPIFFS.h>
+#include <ImgurImage.h>
+#include "reference_images.h"
+
+// Decodes odd-sized reference JPEGs at every decoder scale (1/1 to 1/8) and checks the
+// size, the number of rows and the colours the transform/GIF/change detection stages get.
+// No WiFi or client ID needed, results go to the serial console.
+
+
+struct ReferenceImage {
+  const char*          path;
+  const unsigned char* data;
+  size_t               len;
+  uint16_t             width;
+  uint16_t             height;
+};
+
+const ReferenceImage references[] = {
+  { "/ref_1366x9.jpg", ref_1366x9_jpg, sizeof(ref_1366x9_jpg), 1366, 9 },
+  { "/ref_63x45.jpg",  ref_63x45_jpg,  sizeof(ref_63x45_jpg),  63,   45 },
+  { "/ref_50x33.jpg",  ref_50x33_jpg,  sizeof(ref_50x33_jpg),  50,   33 },
+  { "/ref_17x9.jpg",   ref_17x9_jpg,   sizeof(ref_17x9_jpg),   17,   9 },
+};
+
+
+// counts rows and samples the middle of each quadrant
+class CheckSink : public ImgurRowSink {
+  public:
+    uint16_t width = 0, height = 0, rows = 0;
+    uint8_t  samples[4][3];
+    bool beginImage( uint16_t w, uint16_t h ) {
+      width = w;
+      height = h;
+      rows = 0;
+      memset( samples, 0, sizeof(samples) );
+      return true;
+    }
+    bool writeRow( const uint8_t* rgb888 ) {
+      if( rows == height / 4 || rows == height * 3 / 4 ) {
+        uint8_t q = rows == height / 4 ? 0 : 2;
+        memcpy( samples[q],   rgb888 + ( width / 4 ) * 3, 3 );
+        memcpy( samples[q+1], rgb888 + ( width * 3 / 4 ) * 3, 3 );
+      }
+      rows++;
+      return true;
+    }
+    bool endImage() { return true; }
+};
+
+
+// red, green, blue, white quadrants
+const uint8_t expected[4][3] = { { 255, 0, 0 }, { 0, 255, 0 }, { 0, 0, 255 }, { 255, 255, 255 } };
+
+bool closeTo( const uint8_t* rgb, const uint8_t* ref ) {
+  for( uint8_t c=0; c<3; c++ ) {
+    if( abs( rgb[c] - ref[c] ) > 48 ) return false;
+  }
+  return true;
+}
+
+
+bool check( const ReferenceImage &ref, uint8_t scale ) {
+  File file = SPIFFS.open( ref.path );
+  uint16_t largest = ref.width > ref.height ? ref.width : ref.height;
+  uint16_t maxDimension = scale == 0 ? 0 : largest >> scale;
+  CheckSink sink;
+  bool decoded = imgurDecodeJpeg( file, maxDimension, sink );
+  file.close();
+  uint16_t width = ref.width >> scale, height = ref.height >> scale;
+  bool ok = decoded && sink.width == width && sink.height == height && sink.rows == height;
+  // quadrants too thin to have a middle pixel of their own are only checked for size
+  if( ok && width >= 8 && height >= 8 ) {
+    for( uint8_t q=0; q<4; q++ ) ok = ok && closeTo( sink.samples[q], expected[q] );
+  }
+  Serial.printf("%s 1/%d: %s (%dx%d, %d rows, expected %dx%d)\n", ref.path, 1 << scale, ok ? "PASS" : "FAIL",
+    sink.width, sink.height, sink.rows, width, height );
+  return ok;
+}
+
+
+void setup() {
+  Serial.begin( 115200 );
+  if( !SPIFFS.begin( true ) ) {
+    Serial.println("SPIFFS mount failed");
+    return;
+  }
+  int failed = 0;
+  for( const ReferenceImage &ref : references ) {
+    File file = SPIFFS.open( ref.path, FILE_WRITE );
+    file.write( ref.data, ref.len );
+    file.close();
+    for( uint8_t scale=0; scale<=3; scale++ ) {
+      if( ( ( ref.width < ref.height ? ref.width : ref.height ) >> scale ) == 0 ) continue;
+      if( !check( ref, scale ) ) failed++;
+    }
+    SPIFFS.remove( ref.path );
+  }
+  Serial.printf("%d failed\n", failed);
+}
+
+
+void loop() {
+}
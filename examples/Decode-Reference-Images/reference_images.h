@@ -0,0 +1,737 @@
+// 1366x9, quadrants red/green/blue/white
+const unsigned char ref_1366x9_jpg[] = {
+  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43,
+  0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04,
+  0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07,
+  0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d,
+  0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10,
+  0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18, 0x16, 0x14,
+  0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03, 0x04,
+  0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x09, 0x05, 0x56, 0x03,
+  0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00,
+  0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00,
+  0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00,
+  0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+  0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81,
+  0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24,
+  0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25,
+  0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+  0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56,
+  0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a,
+  0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86,
+  0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+  0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3,
+  0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6,
+  0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9,
+  0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+  0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00,
+  0x1f, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+  0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00,
+  0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31,
+  0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08,
+  0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+  0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18,
+  0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39,
+  0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+  0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84,
+  0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+  0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa,
+  0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+  0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+  0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea,
+  0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda, 0x00,
+  0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf8,
+  0xdb, 0xfe, 0x16, 0xaf, 0xfd, 0x42, 0xff, 0x00, 0xf2, 0x63, 0xff, 0x00,
+  0xb1, 0xa3, 0xfe, 0x16, 0xaf, 0xfd, 0x42, 0xff, 0x00, 0xf2, 0x63, 0xff,
+  0x00, 0xb1, 0xae, 0x02, 0x8a, 0xfe, 0xe1, 0xff, 0x00, 0x88, 0x25, 0xc0,
+  0x1f, 0xf4, 0x2e, 0xff, 0x00, 0xca, 0xb5, 0xff, 0x00, 0xf9, 0x61, 0xf5,
+  0x7f, 0xf1, 0x17, 0xf8, 0xdf, 0xfe, 0x83, 0xff, 0x00, 0xf2, 0x9d, 0x1f,
+  0xfe, 0x56, 0x77, 0xff, 0x00, 0xf0, 0xb5, 0x7f, 0xea, 0x17, 0xff, 0x00,
+  0x93, 0x1f, 0xfd, 0x8d, 0x1f, 0xf0, 0xb5, 0x7f, 0xea, 0x17, 0xff, 0x00,
+  0x93, 0x1f, 0xfd, 0x8d, 0x70, 0x14, 0x51, 0xff, 0x00, 0x10, 0x4b, 0x80,
+  0x3f, 0xe8, 0x5d, 0xff, 0x00, 0x95, 0x6b, 0xff, 0x00, 0xf2, 0xc0, 0xff,
+  0x00, 0x88, 0xbf, 0xc6, 0xff, 0x00, 0xf4, 0x1f, 0xff, 0x00, 0x94, 0xe8,
+  0xff, 0x00, 0xf2, 0xb3, 0xbf, 0xff, 0x00, 0x85, 0xab, 0xff, 0x00, 0x50,
+  0xbf, 0xfc, 0x98, 0xff, 0x00, 0xec, 0x68, 0xff, 0x00, 0x85, 0xab, 0xff,
+  0x00, 0x50, 0xbf, 0xfc, 0x98, 0xff, 0x00, 0xec, 0x6b, 0x80, 0xa2, 0x8f,
+  0xf8, 0x82, 0x5c, 0x01, 0xff, 0x00, 0x42, 0xef, 0xfc, 0xab, 0x5f, 0xff,
+  0x00, 0x96, 0x07, 0xfc, 0x45, 0xfe, 0x37, 0xff, 0x00, 0xa0, 0xff, 0x00,
+  0xfc, 0xa7, 0x47, 0xff, 0x00, 0x95, 0x9d, 0xff, 0x00, 0xfc, 0x2d, 0x5f,
+  0xfa, 0x85, 0xff, 0x00, 0xe4, 0xc7, 0xff, 0x00, 0x63, 0x47, 0xfc, 0x2d,
+  0x5f, 0xfa, 0x85, 0xff, 0x00, 0xe4, 0xc7, 0xff, 0x00, 0x63, 0x5c, 0x05,
+  0x14, 0x7f, 0xc4, 0x12, 0xe0, 0x0f, 0xfa, 0x17, 0x7f, 0xe5, 0x5a, 0xff,
+  0x00, 0xfc, 0xb0, 0x3f, 0xe2, 0x2f, 0xf1, 0xbf, 0xfd, 0x07, 0xff, 0x00,
+  0xe5, 0x3a, 0x3f, 0xfc, 0xac, 0xef, 0xff, 0x00, 0xe1, 0x6a, 0xff, 0x00,
+  0xd4, 0x2f, 0xff, 0x00, 0x26, 0x3f, 0xfb, 0x1a, 0x3f, 0xe1, 0x6a, 0xff,
+  0x00, 0xd4, 0x2f, 0xff, 0x00, 0x26, 0x3f, 0xfb, 0x1a, 0xe0, 0x28, 0xa3,
+  0xfe, 0x20, 0x97, 0x00, 0x7f, 0xd0, 0xbb, 0xff, 0x00, 0x2a, 0xd7, 0xff,
+  0x00, 0xe5, 0x81, 0xff, 0x00, 0x11, 0x7f, 0x8d, 0xff, 0x00, 0xe8, 0x3f,
+  0xff, 0x00, 0x29, 0xd1, 0xff, 0x00, 0xe5, 0x67, 0x7f, 0xff, 0x00, 0x0b,
+  0x57, 0xfe, 0xa1, 0x7f, 0xf9, 0x31, 0xff, 0x00, 0xd8, 0xd1, 0xff, 0x00,
+  0x0b, 0x57, 0xfe, 0xa1, 0x7f, 0xf9, 0x31, 0xff, 0x00, 0xd8, 0xd7, 0x01,
+  0x45, 0x1f, 0xf1, 0x04, 0xb8, 0x03, 0xfe, 0x85, 0xdf, 0xf9, 0x56, 0xbf,
+  0xff, 0x00, 0x2c, 0x0f, 0xf8, 0x8b, 0xfc, 0x6f, 0xff, 0x00, 0x41, 0xff,
+  0x00, 0xf9, 0x4e, 0x8f, 0xff, 0x00, 0x2b, 0x3b, 0xff, 0x00, 0xf8, 0x5a,
+  0xbf, 0xf5, 0x0b, 0xff, 0x00, 0xc9, 0x8f, 0xfe, 0xc6, 0x8f, 0xf8, 0x5a,
+  0xbf, 0xf5, 0x0b, 0xff, 0x00, 0xc9, 0x8f, 0xfe, 0xc6, 0xb8, 0x0a, 0x28,
+  0xff, 0x00, 0x88, 0x25, 0xc0, 0x1f, 0xf4, 0x2e, 0xff, 0x00, 0xca, 0xb5,
+  0xff, 0x00, 0xf9, 0x60, 0x7f, 0xc4, 0x5f, 0xe3, 0x7f, 0xfa, 0x0f, 0xff,
+  0x00, 0xca, 0x74, 0x7f, 0xf9, 0x59, 0xdf, 0xff, 0x00, 0xc2, 0xd5, 0xff,
+  0x00, 0xa8, 0x5f, 0xfe, 0x4c, 0x7f, 0xf6, 0x34, 0x7f, 0xc2, 0xd5, 0xff,
+  0x00, 0xa8, 0x5f, 0xfe, 0x4c, 0x7f, 0xf6, 0x35, 0xc0, 0x51, 0x47, 0xfc,
+  0x41, 0x2e, 0x00, 0xff, 0x00, 0xa1, 0x77, 0xfe, 0x55, 0xaf, 0xff, 0x00,
+  0xcb, 0x03, 0xfe, 0x22, 0xff, 0x00, 0x1b, 0xff, 0x00, 0xd0, 0x7f, 0xfe,
+  0x53, 0xa3, 0xff, 0x00, 0xca, 0xce, 0xff, 0x00, 0xfe, 0x16, 0xaf, 0xfd,
+  0x42, 0xff, 0x00, 0xf2, 0x63, 0xff, 0x00, 0xb1, 0xa3, 0xfe, 0x16, 0xaf,
+  0xfd, 0x42, 0xff, 0x00, 0xf2, 0x63, 0xff, 0x00, 0xb1, 0xae, 0x02, 0x8a,
+  0x3f, 0xe2, 0x09, 0x70, 0x07, 0xfd, 0x0b, 0xbf, 0xf2, 0xad, 0x7f, 0xfe,
+  0x58, 0x1f, 0xf1, 0x17, 0xf8, 0xdf, 0xfe, 0x83, 0xff, 0x00, 0xf2, 0x9d,
+  0x1f, 0xfe, 0x56, 0x77, 0xff, 0x00, 0xf0, 0xb5, 0x7f, 0xea, 0x17, 0xff,
+  0x00, 0x93, 0x1f, 0xfd, 0x8d, 0x1f, 0xf0, 0xb5, 0x7f, 0xea, 0x17, 0xff,
+  0x00, 0x93, 0x1f, 0xfd, 0x8d, 0x70, 0x14, 0x51, 0xff, 0x00, 0x10, 0x4b,
+  0x80, 0x3f, 0xe8, 0x5d, 0xff, 0x00, 0x95, 0x6b, 0xff, 0x00, 0xf2, 0xc0,
+  0xff, 0x00, 0x88, 0xbf, 0xc6, 0xff, 0x00, 0xf4, 0x1f, 0xff, 0x00, 0x94,
+  0xe8, 0xff, 0x00, 0xf2, 0xb3, 0xbf, 0xff, 0x00, 0x85, 0xab, 0xff, 0x00,
+  0x50, 0xbf, 0xfc, 0x98, 0xff, 0x00, 0xec, 0x68, 0xff, 0x00, 0x85, 0xab,
+  0xff, 0x00, 0x50, 0xbf, 0xfc, 0x98, 0xff, 0x00, 0xec, 0x6b, 0x80, 0xa2,
+  0x8f, 0xf8, 0x82, 0x5c, 0x01, 0xff, 0x00, 0x42, 0xef, 0xfc, 0xab, 0x5f,
+  0xff, 0x00, 0x96, 0x07, 0xfc, 0x45, 0xfe, 0x37, 0xff, 0x00, 0xa0, 0xff,
+  0x00, 0xfc, 0xa7, 0x47, 0xff, 0x00, 0x95, 0x9d, 0xff, 0x00, 0xfc, 0x2d,
+  0x5f, 0xfa, 0x85, 0xff, 0x00, 0xe4, 0xc7, 0xff, 0x00, 0x63, 0x47, 0xfc,
+  0x2d, 0x5f, 0xfa, 0x85, 0xff, 0x00, 0xe4, 0xc7, 0xff, 0x00, 0x63, 0x5c,
+  0x05, 0x14, 0x7f, 0xc4, 0x12, 0xe0, 0x0f, 0xfa, 0x17, 0x7f, 0xe5, 0x5a,
+  0xff, 0x00, 0xfc, 0xb0, 0x3f, 0xe2, 0x2f, 0xf1, 0xbf, 0xfd, 0x07, 0xff,
+  0x00, 0xe5, 0x3a, 0x3f, 0xfc, 0xac, 0xef, 0xff, 0x00, 0xe1, 0x6a, 0xff,
+  0x00, 0xd4, 0x2f, 0xff, 0x00, 0x26, 0x3f, 0xfb, 0x1a, 0x3f, 0xe1, 0x6a,
+  0xff, 0x00, 0xd4, 0x2f, 0xff, 0x00, 0x26, 0x3f, 0xfb, 0x1a, 0xe0, 0x28,
+  0xa3, 0xfe, 0x20, 0x97, 0x00, 0x7f, 0xd0, 0xbb, 0xff, 0x00, 0x2a, 0xd7,
+  0xff, 0x00, 0xe5, 0x81, 0xff, 0x00, 0x11, 0x7f, 0x8d, 0xff, 0x00, 0xe8,
+  0x3f, 0xff, 0x00, 0x29, 0xd1, 0xff, 0x00, 0xe5, 0x67, 0x7f, 0xff, 0x00,
+  0x0b, 0x57, 0xfe, 0xa1, 0x7f, 0xf9, 0x31, 0xff, 0x00, 0xd8, 0xd1, 0xff,
+  0x00, 0x0b, 0x57, 0xfe, 0xa1, 0x7f, 0xf9, 0x31, 0xff, 0x00, 0xd8, 0xd7,
+  0x01, 0x45, 0x1f, 0xf1, 0x04, 0xb8, 0x03, 0xfe, 0x85, 0xdf, 0xf9, 0x56,
+  0xbf, 0xff, 0x00, 0x2c, 0x0f, 0xf8, 0x8b, 0xfc, 0x6f, 0xff, 0x00, 0x41,
+  0xff, 0x00, 0xf9, 0x4e, 0x8f, 0xff, 0x00, 0x2b, 0x3b, 0xff, 0x00, 0xf8,
+  0x5a, 0xbf, 0xf5, 0x0b, 0xff, 0x00, 0xc9, 0x8f, 0xfe, 0xc6, 0x8f, 0xf8,
+  0x5a, 0xbf, 0xf5, 0x0b, 0xff, 0x00, 0xc9, 0x8f, 0xfe, 0xc6, 0xb8, 0x0a,
+  0x28, 0xff, 0x00, 0x88, 0x25, 0xc0, 0x1f, 0xf4, 0x2e, 0xff, 0x00, 0xca,
+  0xb5, 0xff, 0x00, 0xf9, 0x60, 0x7f, 0xc4, 0x5f, 0xe3, 0x7f, 0xfa, 0x0f,
+  0xff, 0x00, 0xca, 0x74, 0x7f, 0xf9, 0x59, 0xdf, 0xff, 0x00, 0xc2, 0xd5,
+  0xff, 0x00, 0xa8, 0x5f, 0xfe, 0x4c, 0x7f, 0xf6, 0x34, 0x7f, 0xc2, 0xd5,
+  0xff, 0x00, 0xa8, 0x5f, 0xfe, 0x4c, 0x7f, 0xf6, 0x35, 0xc0, 0x51, 0x47,
+  0xfc, 0x41, 0x2e, 0x00, 0xff, 0x00, 0xa1, 0x77, 0xfe, 0x55, 0xaf, 0xff,
+  0x00, 0xcb, 0x03, 0xfe, 0x22, 0xff, 0x00, 0x1b, 0xff, 0x00, 0xd0, 0x7f,
+  0xfe, 0x53, 0xa3, 0xff, 0x00, 0xca, 0xce, 0xff, 0x00, 0xfe, 0x16, 0xaf,
+  0xfd, 0x42, 0xff, 0x00, 0xf2, 0x63, 0xff, 0x00, 0xb1, 0xa3, 0xfe, 0x16,
+  0xaf, 0xfd, 0x42, 0xff, 0x00, 0xf2, 0x63, 0xff, 0x00, 0xb1, 0xae, 0x02,
+  0x8a, 0x3f, 0xe2, 0x09, 0x70, 0x07, 0xfd, 0x0b, 0xbf, 0xf2, 0xad, 0x7f,
+  0xfe, 0x58, 0x1f, 0xf1, 0x17, 0xf8, 0xdf, 0xfe, 0x83, 0xff, 0x00, 0xf2,
+  0x9d, 0x1f, 0xfe, 0x56, 0x77, 0xff, 0x00, 0xf0, 0xb5, 0x7f, 0xea, 0x17,
+  0xff, 0x00, 0x93, 0x1f, 0xfd, 0x8d, 0x1f, 0xf0, 0xb5, 0x7f, 0xea, 0x17,
+  0xff, 0x00, 0x93, 0x1f, 0xfd, 0x8d, 0x70, 0x14, 0x51, 0xff, 0x00, 0x10,
+  0x4b, 0x80, 0x3f, 0xe8, 0x5d, 0xff, 0x00, 0x95, 0x6b, 0xff, 0x00, 0xf2,
+  0xc0, 0xff, 0x00, 0x88, 0xbf, 0xc6, 0xff, 0x00, 0xf4, 0x1f, 0xff, 0x00,
+  0x94, 0xe8, 0xff, 0x00, 0xf2, 0xb3, 0xbf, 0xff, 0x00, 0x85, 0xab, 0xff,
+  0x00, 0x50, 0xbf, 0xfc, 0x98, 0xff, 0x00, 0xec, 0x68, 0xff, 0x00, 0x85,
+  0xab, 0xff, 0x00, 0x50, 0xbf, 0xfc, 0x98, 0xff, 0x00, 0xec, 0x6b, 0x80,
+  0xa2, 0x8f, 0xf8, 0x82, 0x5c, 0x01, 0xff, 0x00, 0x42, 0xef, 0xfc, 0xab,
+  0x5f, 0xff, 0x00, 0x96, 0x07, 0xfc, 0x45, 0xfe, 0x37, 0xff, 0x00, 0xa0,
+  0xff, 0x00, 0xfc, 0xa7, 0x47, 0xff, 0x00, 0x95, 0x9d, 0xff, 0x00, 0xfc,
+  0x2d, 0x5f, 0xfa, 0x85, 0xff, 0x00, 0xe4, 0xc7, 0xff, 0x00, 0x63, 0x47,
+  0xfc, 0x2d, 0x5f, 0xfa, 0x85, 0xff, 0x00, 0xe4, 0xc7, 0xff, 0x00, 0x63,
+  0x5c, 0x05, 0x14, 0x7f, 0xc4, 0x12, 0xe0, 0x0f, 0xfa, 0x17, 0x7f, 0xe5,
+  0x5a, 0xff, 0x00, 0xfc, 0xb0, 0x3f, 0xe2, 0x2f, 0xf1, 0xbf, 0xfd, 0x07,
+  0xff, 0x00, 0xe5, 0x3a, 0x3f, 0xfc, 0xac, 0xef, 0xff, 0x00, 0xe1, 0x6a,
+  0xff, 0x00, 0xd4, 0x2f, 0xff, 0x00, 0x26, 0x3f, 0xfb, 0x1a, 0x3f, 0xe1,
+  0x6a, 0xff, 0x00, 0xd4, 0x2f, 0xff, 0x00, 0x26, 0x3f, 0xfb, 0x1a, 0xe0,
+  0x28, 0xa3, 0xfe, 0x20, 0x97, 0x00, 0x7f, 0xd0, 0xbb, 0xff, 0x00, 0x2a,
+  0xd7, 0xff, 0x00, 0xe5, 0x81, 0xff, 0x00, 0x11, 0x7f, 0x8d, 0xff, 0x00,
+  0xe8, 0x3f, 0xff, 0x00, 0x29, 0xd1, 0xff, 0x00, 0xe5, 0x67, 0x7f, 0xff,
+  0x00, 0x0b, 0x57, 0xfe, 0xa1, 0x7f, 0xf9, 0x31, 0xff, 0x00, 0xd8, 0xd1,
+  0xff, 0x00, 0x0b, 0x57, 0xfe, 0xa1, 0x7f, 0xf9, 0x31, 0xff, 0x00, 0xd8,
+  0xd7, 0x01, 0x45, 0x1f, 0xf1, 0x04, 0xb8, 0x03, 0xfe, 0x85, 0xdf, 0xf9,
+  0x56, 0xbf, 0xff, 0x00, 0x2c, 0x0f, 0xf8, 0x8b, 0xfc, 0x6f, 0xff, 0x00,
+  0x41, 0xff, 0x00, 0xf9, 0x4e, 0x8f, 0xff, 0x00, 0x2b, 0x3b, 0xff, 0x00,
+  0xf8, 0x5a, 0xbf, 0xf5, 0x0b, 0xff, 0x00, 0xc9, 0x8f, 0xfe, 0xc6, 0x8f,
+  0xf8, 0x5a, 0xbf, 0xf5, 0x0b, 0xff, 0x00, 0xc9, 0x8f, 0xfe, 0xc6, 0xb8,
+  0x0a, 0x28, 0xff, 0x00, 0x88, 0x25, 0xc0, 0x1f, 0xf4, 0x2e, 0xff, 0x00,
+  0xca, 0xb5, 0xff, 0x00, 0xf9, 0x60, 0x7f, 0xc4, 0x5f, 0xe3, 0x7f, 0xfa,
+  0x0f, 0xff, 0x00, 0xca, 0x74, 0x7f, 0xf9, 0x59, 0xdf, 0xff, 0x00, 0xc2,
+  0xd5, 0xff, 0x00, 0xa8, 0x5f, 0xfe, 0x4c, 0x7f, 0xf6, 0x34, 0x7f, 0xc2,
+  0xd5, 0xff, 0x00, 0xa8, 0x5f, 0xfe, 0x4c, 0x7f, 0xf6, 0x35, 0xc0, 0x51,
+  0x47, 0xfc, 0x41, 0x2e, 0x00, 0xff, 0x00, 0xa1, 0x77, 0xfe, 0x55, 0xaf,
+  0xff, 0x00, 0xcb, 0x03, 0xfe, 0x22, 0xff, 0x00, 0x1b, 0xff, 0x00, 0xd0,
+  0x7f, 0xfe, 0x53, 0xa3, 0xff, 0x00, 0xca, 0xce, 0xff, 0x00, 0xfe, 0x16,
+  0xaf, 0xfd, 0x42, 0xff, 0x00, 0xf2, 0x63, 0xff, 0x00, 0xb1, 0xa3, 0xfe,
+  0x16, 0xaf, 0xfd, 0x42, 0xff, 0x00, 0xf2, 0x63, 0xff, 0x00, 0xb1, 0xae,
+  0x02, 0x8a, 0x3f, 0xe2, 0x09, 0x70, 0x07, 0xfd, 0x0b, 0xbf, 0xf2, 0xad,
+  0x7f, 0xfe, 0x58, 0x1f, 0xf1, 0x17, 0xf8, 0xdf, 0xfe, 0x83, 0xff, 0x00,
+  0xf2, 0x9d, 0x1f, 0xfe, 0x56, 0x77, 0xff, 0x00, 0xf0, 0xb5, 0x7f, 0xea,
+  0x17, 0xff, 0x00, 0x93, 0x1f, 0xfd, 0x8d, 0x1f, 0xf0, 0xb5, 0x7f, 0xea,
+  0x17, 0xff, 0x00, 0x93, 0x1f, 0xfd, 0x8d, 0x70, 0x14, 0x51, 0xff, 0x00,
+  0x10, 0x4b, 0x80, 0x3f, 0xe8, 0x5d, 0xff, 0x00, 0x95, 0x6b, 0xff, 0x00,
+  0xf2, 0xc0, 0xff, 0x00, 0x88, 0xbf, 0xc6, 0xff, 0x00, 0xf4, 0x1f, 0xff,
+  0x00, 0x94, 0xe8, 0xff, 0x00, 0xf2, 0xb3, 0xbf, 0xff, 0x00, 0x85, 0xab,
+  0xff, 0x00, 0x50, 0xbf, 0xfc, 0x98, 0xff, 0x00, 0xec, 0x68, 0xff, 0x00,
+  0x85, 0xab, 0xff, 0x00, 0x50, 0xbf, 0xfc, 0x98, 0xff, 0x00, 0xec, 0x6b,
+  0x80, 0xa2, 0x8f, 0xf8, 0x82, 0x5c, 0x01, 0xff, 0x00, 0x42, 0xef, 0xfc,
+  0xab, 0x5f, 0xff, 0x00, 0x96, 0x07, 0xfc, 0x45, 0xfe, 0x37, 0xff, 0x00,
+  0xa0, 0xff, 0x00, 0xfc, 0xa7, 0x47, 0xff, 0x00, 0x95, 0x9d, 0xff, 0x00,
+  0xfc, 0x2d, 0x5f, 0xfa, 0x85, 0xff, 0x00, 0xe4, 0xc7, 0xff, 0x00, 0x63,
+  0x47, 0xfc, 0x2d, 0x5f, 0xfa, 0x85, 0xff, 0x00, 0xe4, 0xc7, 0xff, 0x00,
+  0x63, 0x5c, 0x05, 0x14, 0x7f, 0xc4, 0x12, 0xe0, 0x0f, 0xfa, 0x17, 0x7f,
+  0xe5, 0x5a, 0xff, 0x00, 0xfc, 0xb0, 0x3f, 0xe2, 0x2f, 0xf1, 0xbf, 0xfd,
+  0x07, 0xff, 0x00, 0xe5, 0x3a, 0x3f, 0xfc, 0xac, 0xef, 0xff, 0x00, 0xe1,
+  0x6a, 0xff, 0x00, 0xd4, 0x2f, 0xff, 0x00, 0x26, 0x3f, 0xfb, 0x1a, 0x3f,
+  0xe1, 0x6a, 0xff, 0x00, 0xd4, 0x2f, 0xff, 0x00, 0x26, 0x3f, 0xfb, 0x1a,
+  0xe0, 0x28, 0xa3, 0xfe, 0x20, 0x97, 0x00, 0x7f, 0xd0, 0xbb, 0xff, 0x00,
+  0x2a, 0xd7, 0xff, 0x00, 0xe5, 0x81, 0xff, 0x00, 0x11, 0x7f, 0x8d, 0xff,
+  0x00, 0xe8, 0x3f, 0xff, 0x00, 0x29, 0xd1, 0xff, 0x00, 0xe5, 0x67, 0x7f,
+  0xff, 0x00, 0x0b, 0x57, 0xfe, 0xa1, 0x7f, 0xf9, 0x31, 0xff, 0x00, 0xd8,
+  0xd1, 0xff, 0x00, 0x0b, 0x57, 0xfe, 0xa1, 0x7f, 0xf9, 0x31, 0xff, 0x00,
+  0xd8, 0xd7, 0x01, 0x45, 0x1f, 0xf1, 0x04, 0xb8, 0x03, 0xfe, 0x85, 0xdf,
+  0xf9, 0x56, 0xbf, 0xff, 0x00, 0x2c, 0x0f, 0xf8, 0x8b, 0xfc, 0x6f, 0xff,
+  0x00, 0x41, 0xff, 0x00, 0xf9, 0x4e, 0x8f, 0xff, 0x00, 0x2b, 0x3b, 0xff,
+  0x00, 0xf8, 0x5a, 0xbf, 0xf5, 0x0b, 0xff, 0x00, 0xc9, 0x8f, 0xfe, 0xc6,
+  0x8f, 0xf8, 0x5a, 0xbf, 0xf5, 0x0b, 0xff, 0x00, 0xc9, 0x8f, 0xfe, 0xc6,
+  0xb8, 0x0a, 0x28, 0xff, 0x00, 0x88, 0x25, 0xc0, 0x1f, 0xf4, 0x2e, 0xff,
+  0x00, 0xca, 0xb5, 0xff, 0x00, 0xf9, 0x60, 0x7f, 0xc4, 0x5f, 0xe3, 0x7f,
+  0xfa, 0x0f, 0xff, 0x00, 0xca, 0x74, 0x7f, 0xf9, 0x59, 0xdf, 0xff, 0x00,
+  0xc2, 0xd5, 0xff, 0x00, 0xa8, 0x5f, 0xfe, 0x4c, 0x7f, 0xf6, 0x34, 0x7f,
+  0xc2, 0xd5, 0xff, 0x00, 0xa8, 0x5f, 0xfe, 0x4c, 0x7f, 0xf6, 0x35, 0xc0,
+  0x51, 0x47, 0xfc, 0x41, 0x2e, 0x00, 0xff, 0x00, 0xa1, 0x77, 0xfe, 0x55,
+  0xaf, 0xff, 0x00, 0xcb, 0x03, 0xfe, 0x22, 0xff, 0x00, 0x1b, 0xff, 0x00,
+  0xd0, 0x7f, 0xfe, 0x53, 0xa3, 0xff, 0x00, 0xca, 0xce, 0xff, 0x00, 0xfe,
+  0x16, 0xaf, 0xfd, 0x42, 0xff, 0x00, 0xf2, 0x63, 0xff, 0x00, 0xb1, 0xa3,
+  0xfe, 0x16, 0xaf, 0xfd, 0x42, 0xff, 0x00, 0xf2, 0x63, 0xff, 0x00, 0xb1,
+  0xae, 0x02, 0x8a, 0x3f, 0xe2, 0x09, 0x70, 0x07, 0xfd, 0x0b, 0xbf, 0xf2,
+  0xad, 0x7f, 0xfe, 0x58, 0x1f, 0xf1, 0x17, 0xf8, 0xdf, 0xfe, 0x83, 0xff,
+  0x00, 0xf2, 0x9d, 0x1f, 0xfe, 0x56, 0x77, 0xff, 0x00, 0xf0, 0xb5, 0x7f,
+  0xea, 0x17, 0xff, 0x00, 0x93, 0x1f, 0xfd, 0x8d, 0x1f, 0xf0, 0xb5, 0x7f,
+  0xea, 0x17, 0xff, 0x00, 0x93, 0x1f, 0xfd, 0x8d, 0x70, 0x14, 0x51, 0xff,
+  0x00, 0x10, 0x4b, 0x80, 0x3f, 0xe8, 0x5d, 0xff, 0x00, 0x95, 0x6b, 0xff,
+  0x00, 0xf2, 0xc0, 0xff, 0x00, 0x88, 0xbf, 0xc6, 0xff, 0x00, 0xf4, 0x1f,
+  0xff, 0x00, 0x94, 0xe8, 0xff, 0x00, 0xf2, 0xb3, 0xbf, 0xff, 0x00, 0x85,
+  0xab, 0xff, 0x00, 0x50, 0xbf, 0xfc, 0x98, 0xff, 0x00, 0xec, 0x68, 0xff,
+  0x00, 0x85, 0xab, 0xff, 0x00, 0x50, 0xbf, 0xfc, 0x98, 0xff, 0x00, 0xec,
+  0x6b, 0x80, 0xa2, 0x8f, 0xf8, 0x82, 0x5c, 0x01, 0xff, 0x00, 0x42, 0xef,
+  0xfc, 0xab, 0x5f, 0xff, 0x00, 0x96, 0x07, 0xfc, 0x45, 0xfe, 0x37, 0xff,
+  0x00, 0xa0, 0xff, 0x00, 0xfc, 0xa7, 0x47, 0xff, 0x00, 0x95, 0x9d, 0xff,
+  0x00, 0xfc, 0x2d, 0x5f, 0xfa, 0x85, 0xff, 0x00, 0xe4, 0xc7, 0xff, 0x00,
+  0x63, 0x47, 0xfc, 0x2d, 0x5f, 0xfa, 0x85, 0xff, 0x00, 0xe4, 0xc7, 0xff,
+  0x00, 0x63, 0x5c, 0x05, 0x14, 0x7f, 0xc4, 0x12, 0xe0, 0x0f, 0xfa, 0x17,
+  0x7f, 0xe5, 0x5a, 0xff, 0x00, 0xfc, 0xb0, 0x3f, 0xe2, 0x2f, 0xf1, 0xbf,
+  0xfd, 0x07, 0xff, 0x00, 0xe5, 0x3a, 0x3f, 0xfc, 0xac, 0xef, 0xff, 0x00,
+  0xe1, 0x6a, 0xff, 0x00, 0xd4, 0x2f, 0xff, 0x00, 0x26, 0x3f, 0xfb, 0x1a,
+  0x3f, 0xe1, 0x6a, 0xff, 0x00, 0xd4, 0x2f, 0xff, 0x00, 0x26, 0x3f, 0xfb,
+  0x1a, 0xe0, 0x28, 0xa3, 0xfe, 0x20, 0x97, 0x00, 0x7f, 0xd0, 0xbb, 0xff,
+  0x00, 0x2a, 0xd7, 0xff, 0x00, 0xe5, 0x81, 0xff, 0x00, 0x11, 0x7f, 0x8d,
+  0xff, 0x00, 0xe8, 0x3f, 0xff, 0x00, 0x29, 0xd1, 0xff, 0x00, 0xe5, 0x67,
+  0x7f, 0xff, 0x00, 0x0b, 0x57, 0xfe, 0xa1, 0x7f, 0xf9, 0x31, 0xff, 0x00,
+  0xd8, 0xd1, 0xff, 0x00, 0x0b, 0x57, 0xfe, 0xa1, 0x7f, 0xf9, 0x31, 0xff,
+  0x00, 0xd8, 0xd7, 0x01, 0x45, 0x1f, 0xf1, 0x04, 0xb8, 0x03, 0xfe, 0x85,
+  0xdf, 0xf9, 0x56, 0xbf, 0xff, 0x00, 0x2c, 0x0f, 0xf8, 0x8b, 0xfc, 0x6f,
+  0xff, 0x00, 0x41, 0xff, 0x00, 0xf9, 0x4e, 0x8f, 0xff, 0x00, 0x2b, 0x3b,
+  0xff, 0x00, 0xf8, 0x5a, 0xbf, 0xf5, 0x0b, 0xff, 0x00, 0xc9, 0x8f, 0xfe,
+  0xc6, 0x8f, 0xf8, 0x5a, 0xbf, 0xf5, 0x0b, 0xff, 0x00, 0xc9, 0x8f, 0xfe,
+  0xc6, 0xb8, 0x0a, 0x28, 0xff, 0x00, 0x88, 0x25, 0xc0, 0x1f, 0xf4, 0x2e,
+  0xff, 0x00, 0xca, 0xb5, 0xff, 0x00, 0xf9, 0x60, 0x7f, 0xc4, 0x5f, 0xe3,
+  0x7f, 0xfa, 0x0f, 0xff, 0x00, 0xca, 0x74, 0x7f, 0xf9, 0x59, 0xdf, 0xff,
+  0x00, 0xc2, 0xd5, 0xff, 0x00, 0xa8, 0x5f, 0xfe, 0x4c, 0x7f, 0xf6, 0x34,
+  0x7f, 0xc2, 0xd5, 0xff, 0x00, 0xa8, 0x5f, 0xfe, 0x4c, 0x7f, 0xf6, 0x35,
+  0xc0, 0x51, 0x47, 0xfc, 0x41, 0x2e, 0x00, 0xff, 0x00, 0xa1, 0x77, 0xfe,
+  0x55, 0xaf, 0xff, 0x00, 0xcb, 0x03, 0xfe, 0x22, 0xff, 0x00, 0x1b, 0xff,
+  0x00, 0xd0, 0x7f, 0xfe, 0x53, 0xa3, 0xff, 0x00, 0xca, 0xce, 0xff, 0x00,
+  0xfe, 0x16, 0xaf, 0xfd, 0x42, 0xff, 0x00, 0xf2, 0x63, 0xff, 0x00, 0xb1,
+  0xa3, 0xfe, 0x16, 0xaf, 0xfd, 0x42, 0xff, 0x00, 0xf2, 0x63, 0xff, 0x00,
+  0xb1, 0xae, 0x02, 0x8a, 0x3f, 0xe2, 0x09, 0x70, 0x07, 0xfd, 0x0b, 0xbf,
+  0xf2, 0xad, 0x7f, 0xfe, 0x58, 0x1f, 0xf1, 0x17, 0xf8, 0xdf, 0xfe, 0x83,
+  0xff, 0x00, 0xf2, 0x9d, 0x1f, 0xfe, 0x56, 0x77, 0xff, 0x00, 0xf0, 0xb5,
+  0x7f, 0xea, 0x17, 0xff, 0x00, 0x93, 0x1f, 0xfd, 0x8d, 0x1f, 0xf0, 0xb5,
+  0x7f, 0xea, 0x17, 0xff, 0x00, 0x93, 0x1f, 0xfd, 0x8d, 0x70, 0x14, 0x51,
+  0xff, 0x00, 0x10, 0x4b, 0x80, 0x3f, 0xe8, 0x5d, 0xff, 0x00, 0x95, 0x6b,
+  0xff, 0x00, 0xf2, 0xc0, 0xff, 0x00, 0x88, 0xbf, 0xc6, 0xff, 0x00, 0xf4,
+  0x1f, 0xff, 0x00, 0x94, 0xe8, 0xff, 0x00, 0xf2, 0xb3, 0xbf, 0xff, 0x00,
+  0x85, 0xab, 0xff, 0x00, 0x50, 0xbf, 0xfc, 0x98, 0xff, 0x00, 0xec, 0x6b,
+  0xef, 0xaf, 0xd8, 0x13, 0xe1, 0x47, 0xfc, 0x2f, 0x3f, 0x83, 0xba, 0xc6,
+  0xbd, 0xfd, 0xa9, 0xfd, 0x89, 0xf6, 0x7d, 0x7a, 0x6b, 0x1f, 0xb3, 0xfd,
+  0x9f, 0xed, 0x1b, 0xb6, 0xdb, 0xdb, 0xbe, 0xed, 0xdb, 0x93, 0x1f, 0xeb,
+  0x31, 0x8c, 0x76, 0xeb, 0xcd, 0x7e, 0x63, 0x57, 0xeb, 0xcf, 0xfc, 0x12,
+  0x17, 0xfe, 0x4d, 0xaf, 0xc4, 0xbf, 0xf6, 0x36, 0xdc, 0xff, 0x00, 0xe9,
+  0x1d, 0x95, 0x7e, 0x51, 0xe2, 0x77, 0x84, 0x7c, 0x15, 0x95, 0xf0, 0xf4,
+  0xf1, 0x38, 0x3c, 0x0f, 0x2c, 0xf9, 0xe2, 0xaf, 0xed, 0x2a, 0xbd, 0xdf,
+  0x67, 0x51, 0xa3, 0xe6, 0xf8, 0x83, 0x8b, 0x33, 0x9e, 0x3c, 0xc0, 0xbc,
+  0x97, 0x88, 0xeb, 0xfb, 0x7c, 0x3b, 0x6a, 0x4e, 0x3c, 0xb0, 0x86, 0xb1,
+  0xd9, 0xf3, 0x53, 0x8c, 0x65, 0xa7, 0xad, 0xbb, 0x9e, 0xad, 0xff, 0x00,
+  0x0c, 0x83, 0xff, 0x00, 0x53, 0x6f, 0xfe, 0x53, 0x7f, 0xfb, 0x6d, 0x1f,
+  0xf0, 0xc8, 0x3f, 0xf5, 0x36, 0xff, 0x00, 0xe5, 0x37, 0xff, 0x00, 0xb6,
+  0xd7, 0xd1, 0x94, 0x57, 0xf1, 0xef, 0xfa, 0x93, 0x90, 0x7f, 0xd0, 0x3f,
+  0xfe, 0x4f, 0x3f, 0xfe, 0x48, 0xfc, 0xc7, 0xfe, 0x21, 0xd7, 0x0b, 0xff,
+  0x00, 0xd0, 0x27, 0xfe, 0x4f, 0x53, 0xff, 0x00, 0x93, 0x3e, 0x73, 0xff,
+  0x00, 0x86, 0x41, 0xff, 0x00, 0xa9, 0xb7, 0xff, 0x00, 0x29, 0xbf, 0xfd,
+  0xb6, 0x8f, 0xf8, 0x64, 0x1f, 0xfa, 0x9b, 0x7f, 0xf2, 0x9b, 0xff, 0x00,
+  0xdb, 0x6b, 0xe8, 0xca, 0x28, 0xff, 0x00, 0x52, 0x72, 0x0f, 0xfa, 0x07,
+  0xff, 0x00, 0xc9, 0xe7, 0xff, 0x00, 0xc9, 0x07, 0xfc, 0x43, 0xae, 0x17,
+  0xff, 0x00, 0xa0, 0x4f, 0xfc, 0x9e, 0xa7, 0xff, 0x00, 0x26, 0x7c, 0xe7,
+  0xff, 0x00, 0x0c, 0x83, 0xff, 0x00, 0x53, 0x6f, 0xfe, 0x53, 0x7f, 0xfb,
+  0x6d, 0x1f, 0xf0, 0xc8, 0x3f, 0xf5, 0x36, 0xff, 0x00, 0xe5, 0x37, 0xff,
+  0x00, 0xb6, 0xd7, 0xd1, 0x94, 0x51, 0xfe, 0xa4, 0xe4, 0x1f, 0xf4, 0x0f,
+  0xff, 0x00, 0x93, 0xcf, 0xff, 0x00, 0x92, 0x0f, 0xf8, 0x87, 0x5c, 0x2f,
+  0xff, 0x00, 0x40, 0x9f, 0xf9, 0x3d, 0x4f, 0xfe, 0x4c, 0xf9, 0xcf, 0xfe,
+  0x19, 0x07, 0xfe, 0xa6, 0xdf, 0xfc, 0xa6, 0xff, 0x00, 0xf6, 0xda, 0x3f,
+  0xe1, 0x90, 0x7f, 0xea, 0x6d, 0xff, 0x00, 0xca, 0x6f, 0xff, 0x00, 0x6d,
+  0xaf, 0xa3, 0x28, 0xa3, 0xfd, 0x49, 0xc8, 0x3f, 0xe8, 0x1f, 0xff, 0x00,
+  0x27, 0x9f, 0xff, 0x00, 0x24, 0x1f, 0xf1, 0x0e, 0xb8, 0x5f, 0xfe, 0x81,
+  0x3f, 0xf2, 0x7a, 0x9f, 0xfc, 0x99, 0xf3, 0x9f, 0xfc, 0x32, 0x0f, 0xfd,
+  0x4d, 0xbf, 0xf9, 0x4d, 0xff, 0x00, 0xed, 0xb4, 0x7f, 0xc3, 0x20, 0xff,
+  0x00, 0xd4, 0xdb, 0xff, 0x00, 0x94, 0xdf, 0xfe, 0xdb, 0x5f, 0x46, 0x51,
+  0x47, 0xfa, 0x93, 0x90, 0x7f, 0xd0, 0x3f, 0xfe, 0x4f, 0x3f, 0xfe, 0x48,
+  0x3f, 0xe2, 0x1d, 0x70, 0xbf, 0xfd, 0x02, 0x7f, 0xe4, 0xf5, 0x3f, 0xf9,
+  0x33, 0xe7, 0x3f, 0xf8, 0x64, 0x1f, 0xfa, 0x9b, 0x7f, 0xf2, 0x9b, 0xff,
+  0x00, 0xdb, 0x68, 0xff, 0x00, 0x86, 0x41, 0xff, 0x00, 0xa9, 0xb7, 0xff,
+  0x00, 0x29, 0xbf, 0xfd, 0xb6, 0xbe, 0x8c, 0xa2, 0x8f, 0xf5, 0x27, 0x20,
+  0xff, 0x00, 0xa0, 0x7f, 0xfc, 0x9e, 0x7f, 0xfc, 0x90, 0x7f, 0xc4, 0x3a,
+  0xe1, 0x7f, 0xfa, 0x04, 0xff, 0x00, 0xc9, 0xea, 0x7f, 0xf2, 0x67, 0xce,
+  0x7f, 0xf0, 0xc8, 0x3f, 0xf5, 0x36, 0xff, 0x00, 0xe5, 0x37, 0xff, 0x00,
+  0xb6, 0xd1, 0xff, 0x00, 0x0c, 0x83, 0xff, 0x00, 0x53, 0x6f, 0xfe, 0x53,
+  0x7f, 0xfb, 0x6d, 0x7d, 0x19, 0x45, 0x1f, 0xea, 0x4e, 0x41, 0xff, 0x00,
+  0x40, 0xff, 0x00, 0xf9, 0x3c, 0xff, 0x00, 0xf9, 0x20, 0xff, 0x00, 0x88,
+  0x75, 0xc2, 0xff, 0x00, 0xf4, 0x09, 0xff, 0x00, 0x93, 0xd4, 0xff, 0x00,
+  0xe4, 0xcf, 0x9c, 0xff, 0x00, 0xe1, 0x90, 0x7f, 0xea, 0x6d, 0xff, 0x00,
+  0xca, 0x6f, 0xff, 0x00, 0x6d, 0xa3, 0xfe, 0x19, 0x07, 0xfe, 0xa6, 0xdf,
+  0xfc, 0xa6, 0xff, 0x00, 0xf6, 0xda, 0xfa, 0x32, 0x8a, 0x3f, 0xd4, 0x9c,
+  0x83, 0xfe, 0x81, 0xff, 0x00, 0xf2, 0x79, 0xff, 0x00, 0xf2, 0x41, 0xff,
+  0x00, 0x10, 0xeb, 0x85, 0xff, 0x00, 0xe8, 0x13, 0xff, 0x00, 0x27, 0xa9,
+  0xff, 0x00, 0xc9, 0x9f, 0x39, 0xff, 0x00, 0xc3, 0x20, 0xff, 0x00, 0xd4,
+  0xdb, 0xff, 0x00, 0x94, 0xdf, 0xfe, 0xdb, 0x47, 0xfc, 0x32, 0x0f, 0xfd,
+  0x4d, 0xbf, 0xf9, 0x4d, 0xff, 0x00, 0xed, 0xb5, 0xf4, 0x65, 0x14, 0x7f,
+  0xa9, 0x39, 0x07, 0xfd, 0x03, 0xff, 0x00, 0xe4, 0xf3, 0xff, 0x00, 0xe4,
+  0x83, 0xfe, 0x21, 0xd7, 0x0b, 0xff, 0x00, 0xd0, 0x27, 0xfe, 0x4f, 0x53,
+  0xff, 0x00, 0x93, 0x3e, 0x73, 0xff, 0x00, 0x86, 0x41, 0xff, 0x00, 0xa9,
+  0xb7, 0xff, 0x00, 0x29, 0xbf, 0xfd, 0xb6, 0x8f, 0xf8, 0x64, 0x1f, 0xfa,
+  0x9b, 0x7f, 0xf2, 0x9b, 0xff, 0x00, 0xdb, 0x6b, 0xe8, 0xca, 0x28, 0xff,
+  0x00, 0x52, 0x72, 0x0f, 0xfa, 0x07, 0xff, 0x00, 0xc9, 0xe7, 0xff, 0x00,
+  0xc9, 0x07, 0xfc, 0x43, 0xae, 0x17, 0xff, 0x00, 0xa0, 0x4f, 0xfc, 0x9e,
+  0xa7, 0xff, 0x00, 0x26, 0x7c, 0xe7, 0xff, 0x00, 0x0c, 0x83, 0xff, 0x00,
+  0x53, 0x6f, 0xfe, 0x53, 0x7f, 0xfb, 0x6d, 0x1f, 0xf0, 0xc8, 0x3f, 0xf5,
+  0x36, 0xff, 0x00, 0xe5, 0x37, 0xff, 0x00, 0xb6, 0xd7, 0xd1, 0x94, 0x51,
+  0xfe, 0xa4, 0xe4, 0x1f, 0xf4, 0x0f, 0xff, 0x00, 0x93, 0xcf, 0xff, 0x00,
+  0x92, 0x0f, 0xf8, 0x87, 0x5c, 0x2f, 0xff, 0x00, 0x40, 0x9f, 0xf9, 0x3d,
+  0x4f, 0xfe, 0x4c, 0xf9, 0xcf, 0xfe, 0x19, 0x07, 0xfe, 0xa6, 0xdf, 0xfc,
+  0xa6, 0xff, 0x00, 0xf6, 0xda, 0x3f, 0xe1, 0x90, 0x7f, 0xea, 0x6d, 0xff,
+  0x00, 0xca, 0x6f, 0xff, 0x00, 0x6d, 0xaf, 0xa3, 0x28, 0xa3, 0xfd, 0x49,
+  0xc8, 0x3f, 0xe8, 0x1f, 0xff, 0x00, 0x27, 0x9f, 0xff, 0x00, 0x24, 0x1f,
+  0xf1, 0x0e, 0xb8, 0x5f, 0xfe, 0x81, 0x3f, 0xf2, 0x7a, 0x9f, 0xfc, 0x99,
+  0xf3, 0x9f, 0xfc, 0x32, 0x0f, 0xfd, 0x4d, 0xbf, 0xf9, 0x4d, 0xff, 0x00,
+  0xed, 0xb4, 0x7f, 0xc3, 0x20, 0xff, 0x00, 0xd4, 0xdb, 0xff, 0x00, 0x94,
+  0xdf, 0xfe, 0xdb, 0x5f, 0x46, 0x51, 0x47, 0xfa, 0x93, 0x90, 0x7f, 0xd0,
+  0x3f, 0xfe, 0x4f, 0x3f, 0xfe, 0x48, 0x3f, 0xe2, 0x1d, 0x70, 0xbf, 0xfd,
+  0x02, 0x7f, 0xe4, 0xf5, 0x3f, 0xf9, 0x33, 0xe7, 0x3f, 0xf8, 0x64, 0x1f,
+  0xfa, 0x9b, 0x7f, 0xf2, 0x9b, 0xff, 0x00, 0xdb, 0x68, 0xff, 0x00, 0x86,
+  0x41, 0xff, 0x00, 0xa9, 0xb7, 0xff, 0x00, 0x29, 0xbf, 0xfd, 0xb6, 0xbe,
+  0x8c, 0xa2, 0x8f, 0xf5, 0x27, 0x20, 0xff, 0x00, 0xa0, 0x7f, 0xfc, 0x9e,
+  0x7f, 0xfc, 0x90, 0x7f, 0xc4, 0x3a, 0xe1, 0x7f, 0xfa, 0x04, 0xff, 0x00,
+  0xc9, 0xea, 0x7f, 0xf2, 0x67, 0xce, 0x7f, 0xf0, 0xc8, 0x3f, 0xf5, 0x36,
+  0xff, 0x00, 0xe5, 0x37, 0xff, 0x00, 0xb6, 0xd1, 0xff, 0x00, 0x0c, 0x83,
+  0xff, 0x00, 0x53, 0x6f, 0xfe, 0x53, 0x7f, 0xfb, 0x6d, 0x7d, 0x19, 0x45,
+  0x1f, 0xea, 0x4e, 0x41, 0xff, 0x00, 0x40, 0xff, 0x00, 0xf9, 0x3c, 0xff,
+  0x00, 0xf9, 0x20, 0xff, 0x00, 0x88, 0x75, 0xc2, 0xff, 0x00, 0xf4, 0x09,
+  0xff, 0x00, 0x93, 0xd4, 0xff, 0x00, 0xe4, 0xcf, 0x9c, 0xff, 0x00, 0xe1,
+  0x90, 0x7f, 0xea, 0x6d, 0xff, 0x00, 0xca, 0x6f, 0xff, 0x00, 0x6d, 0xa3,
+  0xfe, 0x19, 0x07, 0xfe, 0xa6, 0xdf, 0xfc, 0xa6, 0xff, 0x00, 0xf6, 0xda,
+  0xfa, 0x32, 0x8a, 0x3f, 0xd4, 0x9c, 0x83, 0xfe, 0x81, 0xff, 0x00, 0xf2,
+  0x79, 0xff, 0x00, 0xf2, 0x41, 0xff, 0x00, 0x10, 0xeb, 0x85, 0xff, 0x00,
+  0xe8, 0x13, 0xff, 0x00, 0x27, 0xa9, 0xff, 0x00, 0xc9, 0x9f, 0x39, 0xff,
+  0x00, 0xc3, 0x20, 0xff, 0x00, 0xd4, 0xdb, 0xff, 0x00, 0x94, 0xdf, 0xfe,
+  0xdb, 0x47, 0xfc, 0x32, 0x0f, 0xfd, 0x4d, 0xbf, 0xf9, 0x4d, 0xff, 0x00,
+  0xed, 0xb5, 0xf4, 0x65, 0x14, 0x7f, 0xa9, 0x39, 0x07, 0xfd, 0x03, 0xff,
+  0x00, 0xe4, 0xf3, 0xff, 0x00, 0xe4, 0x83, 0xfe, 0x21, 0xd7, 0x0b, 0xff,
+  0x00, 0xd0, 0x27, 0xfe, 0x4f, 0x53, 0xff, 0x00, 0x93, 0x3e, 0x73, 0xff,
+  0x00, 0x86, 0x41, 0xff, 0x00, 0xa9, 0xb7, 0xff, 0x00, 0x29, 0xbf, 0xfd,
+  0xb6, 0x8f, 0xf8, 0x64, 0x1f, 0xfa, 0x9b, 0x7f, 0xf2, 0x9b, 0xff, 0x00,
+  0xdb, 0x6b, 0xe8, 0xca, 0x28, 0xff, 0x00, 0x52, 0x72, 0x0f, 0xfa, 0x07,
+  0xff, 0x00, 0xc9, 0xe7, 0xff, 0x00, 0xc9, 0x07, 0xfc, 0x43, 0xae, 0x17,
+  0xff, 0x00, 0xa0, 0x4f, 0xfc, 0x9e, 0xa7, 0xff, 0x00, 0x26, 0x7c, 0xe7,
+  0xff, 0x00, 0x0c, 0x83, 0xff, 0x00, 0x53, 0x6f, 0xfe, 0x53, 0x7f, 0xfb,
+  0x6d, 0x1f, 0xf0, 0xc8, 0x3f, 0xf5, 0x36, 0xff, 0x00, 0xe5, 0x37, 0xff,
+  0x00, 0xb6, 0xd7, 0xd1, 0x94, 0x51, 0xfe, 0xa4, 0xe4, 0x1f, 0xf4, 0x0f,
+  0xff, 0x00, 0x93, 0xcf, 0xff, 0x00, 0x92, 0x0f, 0xf8, 0x87, 0x5c, 0x2f,
+  0xff, 0x00, 0x40, 0x9f, 0xf9, 0x3d, 0x4f, 0xfe, 0x4c, 0xf9, 0xcf, 0xfe,
+  0x19, 0x07, 0xfe, 0xa6, 0xdf, 0xfc, 0xa6, 0xff, 0x00, 0xf6, 0xda, 0x3f,
+  0xe1, 0x90, 0x7f, 0xea, 0x6d, 0xff, 0x00, 0xca, 0x6f, 0xff, 0x00, 0x6d,
+  0xaf, 0xa3, 0x28, 0xa3, 0xfd, 0x49, 0xc8, 0x3f, 0xe8, 0x1f, 0xff, 0x00,
+  0x27, 0x9f, 0xff, 0x00, 0x24, 0x1f, 0xf1, 0x0e, 0xb8, 0x5f, 0xfe, 0x81,
+  0x3f, 0xf2, 0x7a, 0x9f, 0xfc, 0x99, 0xf3, 0x9f, 0xfc, 0x32, 0x0f, 0xfd,
+  0x4d, 0xbf, 0xf9, 0x4d, 0xff, 0x00, 0xed, 0xb4, 0x7f, 0xc3, 0x20, 0xff,
+  0x00, 0xd4, 0xdb, 0xff, 0x00, 0x94, 0xdf, 0xfe, 0xdb, 0x5f, 0x46, 0x51,
+  0x47, 0xfa, 0x93, 0x90, 0x7f, 0xd0, 0x3f, 0xfe, 0x4f, 0x3f, 0xfe, 0x48,
+  0x3f, 0xe2, 0x1d, 0x70, 0xbf, 0xfd, 0x02, 0x7f, 0xe4, 0xf5, 0x3f, 0xf9,
+  0x33, 0xe7, 0x3f, 0xf8, 0x64, 0x1f, 0xfa, 0x9b, 0x7f, 0xf2, 0x9b, 0xff,
+  0x00, 0xdb, 0x68, 0xff, 0x00, 0x86, 0x41, 0xff, 0x00, 0xa9, 0xb7, 0xff,
+  0x00, 0x29, 0xbf, 0xfd, 0xb6, 0xbe, 0x8c, 0xa2, 0x8f, 0xf5, 0x27, 0x20,
+  0xff, 0x00, 0xa0, 0x7f, 0xfc, 0x9e, 0x7f, 0xfc, 0x90, 0x7f, 0xc4, 0x3a,
+  0xe1, 0x7f, 0xfa, 0x04, 0xff, 0x00, 0xc9, 0xea, 0x7f, 0xf2, 0x67, 0xce,
+  0x7f, 0xf0, 0xc8, 0x3f, 0xf5, 0x36, 0xff, 0x00, 0xe5, 0x37, 0xff, 0x00,
+  0xb6, 0xd1, 0xff, 0x00, 0x0c, 0x83, 0xff, 0x00, 0x53, 0x6f, 0xfe, 0x53,
+  0x7f, 0xfb, 0x6d, 0x7d, 0x19, 0x45, 0x1f, 0xea, 0x4e, 0x41, 0xff, 0x00,
+  0x40, 0xff, 0x00, 0xf9, 0x3c, 0xff, 0x00, 0xf9, 0x20, 0xff, 0x00, 0x88,
+  0x75, 0xc2, 0xff, 0x00, 0xf4, 0x09, 0xff, 0x00, 0x93, 0xd4, 0xff, 0x00,
+  0xe4, 0xcf, 0x9c, 0xff, 0x00, 0xe1, 0x90, 0x7f, 0xea, 0x6d, 0xff, 0x00,
+  0xca, 0x6f, 0xff, 0x00, 0x6d, 0xa3, 0xfe, 0x19, 0x07, 0xfe, 0xa6, 0xdf,
+  0xfc, 0xa6, 0xff, 0x00, 0xf6, 0xda, 0xfa, 0x32, 0x8a, 0x3f, 0xd4, 0x9c,
+  0x83, 0xfe, 0x81, 0xff, 0x00, 0xf2, 0x79, 0xff, 0x00, 0xf2, 0x41, 0xff,
+  0x00, 0x10, 0xeb, 0x85, 0xff, 0x00, 0xe8, 0x13, 0xff, 0x00, 0x27, 0xa9,
+  0xff, 0x00, 0xc9, 0x9f, 0x39, 0xff, 0x00, 0xc3, 0x20, 0xff, 0x00, 0xd4,
+  0xdb, 0xff, 0x00, 0x94, 0xdf, 0xfe, 0xdb, 0x47, 0xfc, 0x32, 0x0f, 0xfd,
+  0x4d, 0xbf, 0xf9, 0x4d, 0xff, 0x00, 0xed, 0xb5, 0xf4, 0x65, 0x14, 0x7f,
+  0xa9, 0x39, 0x07, 0xfd, 0x03, 0xff, 0x00, 0xe4, 0xf3, 0xff, 0x00, 0xe4,
+  0x83, 0xfe, 0x21, 0xd7, 0x0b, 0xff, 0x00, 0xd0, 0x27, 0xfe, 0x4f, 0x53,
+  0xff, 0x00, 0x93, 0x3e, 0x73, 0xff, 0x00, 0x86, 0x41, 0xff, 0x00, 0xa9,
+  0xb7, 0xff, 0x00, 0x29, 0xbf, 0xfd, 0xb6, 0x8f, 0xf8, 0x64, 0x1f, 0xfa,
+  0x9b, 0x7f, 0xf2, 0x9b, 0xff, 0x00, 0xdb, 0x6b, 0xe8, 0xca, 0x28, 0xff,
+  0x00, 0x52, 0x72, 0x0f, 0xfa, 0x07, 0xff, 0x00, 0xc9, 0xe7, 0xff, 0x00,
+  0xc9, 0x07, 0xfc, 0x43, 0xae, 0x17, 0xff, 0x00, 0xa0, 0x4f, 0xfc, 0x9e,
+  0xa7, 0xff, 0x00, 0x26, 0x7c, 0xe7, 0xff, 0x00, 0x0c, 0x83, 0xff, 0x00,
+  0x53, 0x6f, 0xfe, 0x53, 0x7f, 0xfb, 0x6d, 0x1f, 0xf0, 0xc8, 0x3f, 0xf5,
+  0x36, 0xff, 0x00, 0xe5, 0x37, 0xff, 0x00, 0xb6, 0xd7, 0xd1, 0x94, 0x51,
+  0xfe, 0xa4, 0xe4, 0x1f, 0xf4, 0x0f, 0xff, 0x00, 0x93, 0xcf, 0xff, 0x00,
+  0x92, 0x0f, 0xf8, 0x87, 0x5c, 0x2f, 0xff, 0x00, 0x40, 0x9f, 0xf9, 0x3d,
+  0x4f, 0xfe, 0x4c, 0xf9, 0xcf, 0xfe, 0x19, 0x07, 0xfe, 0xa6, 0xdf, 0xfc,
+  0xa6, 0xff, 0x00, 0xf6, 0xda, 0x3f, 0xe1, 0x90, 0x7f, 0xea, 0x6d, 0xff,
+  0x00, 0xca, 0x6f, 0xff, 0x00, 0x6d, 0xaf, 0xa3, 0x28, 0xa3, 0xfd, 0x49,
+  0xc8, 0x3f, 0xe8, 0x1f, 0xff, 0x00, 0x27, 0x9f, 0xff, 0x00, 0x24, 0x1f,
+  0xf1, 0x0e, 0xb8, 0x5f, 0xfe, 0x81, 0x3f, 0xf2, 0x7a, 0x9f, 0xfc, 0x99,
+  0xf3, 0x9f, 0xfc, 0x32, 0x0f, 0xfd, 0x4d, 0xbf, 0xf9, 0x4d, 0xff, 0x00,
+  0xed, 0xb4, 0x7f, 0xc3, 0x20, 0xff, 0x00, 0xd4, 0xdb, 0xff, 0x00, 0x94,
+  0xdf, 0xfe, 0xdb, 0x5f, 0x46, 0x51, 0x47, 0xfa, 0x93, 0x90, 0x7f, 0xd0,
+  0x3f, 0xfe, 0x4f, 0x3f, 0xfe, 0x48, 0x3f, 0xe2, 0x1d, 0x70, 0xbf, 0xfd,
+  0x02, 0x7f, 0xe4, 0xf5, 0x3f, 0xf9, 0x33, 0xe7, 0x3f, 0xf8, 0x64, 0x1f,
+  0xfa, 0x9b, 0x7f, 0xf2, 0x9b, 0xff, 0x00, 0xdb, 0x68, 0xff, 0x00, 0x86,
+  0x41, 0xff, 0x00, 0xa9, 0xb7, 0xff, 0x00, 0x29, 0xbf, 0xfd, 0xb6, 0xbe,
+  0x8c, 0xa2, 0x8f, 0xf5, 0x27, 0x20, 0xff, 0x00, 0xa0, 0x7f, 0xfc, 0x9e,
+  0x7f, 0xfc, 0x90, 0x7f, 0xc4, 0x3a, 0xe1, 0x7f, 0xfa, 0x04, 0xff, 0x00,
+  0xc9, 0xea, 0x7f, 0xf2, 0x67, 0xce, 0x7f, 0xf0, 0xc8, 0x3f, 0xf5, 0x36,
+  0xff, 0x00, 0xe5, 0x37, 0xff, 0x00, 0xb6, 0xd1, 0xff, 0x00, 0x0c, 0x83,
+  0xff, 0x00, 0x53, 0x6f, 0xfe, 0x53, 0x7f, 0xfb, 0x6d, 0x7d, 0x19, 0x45,
+  0x1f, 0xea, 0x4e, 0x41, 0xff, 0x00, 0x40, 0xff, 0x00, 0xf9, 0x3c, 0xff,
+  0x00, 0xf9, 0x20, 0xff, 0x00, 0x88, 0x75, 0xc2, 0xff, 0x00, 0xf4, 0x09,
+  0xff, 0x00, 0x93, 0xd4, 0xff, 0x00, 0xe4, 0xcf, 0x9c, 0xff, 0x00, 0xe1,
+  0x90, 0x7f, 0xea, 0x6d, 0xff, 0x00, 0xca, 0x6f, 0xff, 0x00, 0x6d, 0xa3,
+  0xfe, 0x19, 0x07, 0xfe, 0xa6, 0xdf, 0xfc, 0xa6, 0xff, 0x00, 0xf6, 0xda,
+  0xfa, 0x32, 0x8a, 0x3f, 0xd4, 0x9c, 0x83, 0xfe, 0x81, 0xff, 0x00, 0xf2,
+  0x79, 0xff, 0x00, 0xf2, 0x41, 0xff, 0x00, 0x10, 0xeb, 0x85, 0xff, 0x00,
+  0xe8, 0x13, 0xff, 0x00, 0x27, 0xa9, 0xff, 0x00, 0xc9, 0x9f, 0x39, 0xff,
+  0x00, 0xc3, 0x20, 0xff, 0x00, 0xd4, 0xdb, 0xff, 0x00, 0x94, 0xdf, 0xfe,
+  0xdb, 0x47, 0xfc, 0x32, 0x0f, 0xfd, 0x4d, 0xbf, 0xf9, 0x4d, 0xff, 0x00,
+  0xed, 0xb5, 0xf4, 0x65, 0x14, 0x7f, 0xa9, 0x39, 0x07, 0xfd, 0x03, 0xff,
+  0x00, 0xe4, 0xf3, 0xff, 0x00, 0xe4, 0x83, 0xfe, 0x21, 0xd7, 0x0b, 0xff,
+  0x00, 0xd0, 0x27, 0xfe, 0x4f, 0x53, 0xff, 0x00, 0x93, 0x3e, 0x73, 0xff,
+  0x00, 0x86, 0x41, 0xff, 0x00, 0xa9, 0xb7, 0xff, 0x00, 0x29, 0xbf, 0xfd,
+  0xb6, 0x8f, 0xf8, 0x64, 0x1f, 0xfa, 0x9b, 0x7f, 0xf2, 0x9b, 0xff, 0x00,
+  0xdb, 0x6b, 0xe8, 0xca, 0x28, 0xff, 0x00, 0x52, 0x72, 0x0f, 0xfa, 0x07,
+  0xff, 0x00, 0xc9, 0xe7, 0xff, 0x00, 0xc9, 0x07, 0xfc, 0x43, 0xae, 0x17,
+  0xff, 0x00, 0xa0, 0x4f, 0xfc, 0x9e, 0xa7, 0xff, 0x00, 0x26, 0x7c, 0xe7,
+  0xff, 0x00, 0x0c, 0x83, 0xff, 0x00, 0x53, 0x6f, 0xfe, 0x53, 0x7f, 0xfb,
+  0x6d, 0x1f, 0xf0, 0xc8, 0x3f, 0xf5, 0x36, 0xff, 0x00, 0xe5, 0x37, 0xff,
+  0x00, 0xb6, 0xd7, 0xd1, 0x94, 0x51, 0xfe, 0xa4, 0xe4, 0x1f, 0xf4, 0x0f,
+  0xff, 0x00, 0x93, 0xcf, 0xff, 0x00, 0x92, 0x0f, 0xf8, 0x87, 0x5c, 0x2f,
+  0xff, 0x00, 0x40, 0x9f, 0xf9, 0x3d, 0x4f, 0xfe, 0x4c, 0xf9, 0xcf, 0xfe,
+  0x19, 0x07, 0xfe, 0xa6, 0xdf, 0xfc, 0xa6, 0xff, 0x00, 0xf6, 0xda, 0x3f,
+  0xe1, 0x90, 0x7f, 0xea, 0x6d, 0xff, 0x00, 0xca, 0x6f, 0xff, 0x00, 0x6d,
+  0xaf, 0xa3, 0x28, 0xa3, 0xfd, 0x49, 0xc8, 0x3f, 0xe8, 0x1f, 0xff, 0x00,
+  0x27, 0x9f, 0xff, 0x00, 0x24, 0x1f, 0xf1, 0x0e, 0xb8, 0x5f, 0xfe, 0x81,
+  0x3f, 0xf2, 0x7a, 0x9f, 0xfc, 0x99, 0xf3, 0x9f, 0xfc, 0x32, 0x0f, 0xfd,
+  0x4d, 0xbf, 0xf9, 0x4d, 0xff, 0x00, 0xed, 0xb4, 0x7f, 0xc3, 0x20, 0xff,
+  0x00, 0xd4, 0xdb, 0xff, 0x00, 0x94, 0xdf, 0xfe, 0xdb, 0x5f, 0x46, 0x51,
+  0x47, 0xfa, 0x93, 0x90, 0x7f, 0xd0, 0x3f, 0xfe, 0x4f, 0x3f, 0xfe, 0x48,
+  0x3f, 0xe2, 0x1d, 0x70, 0xbf, 0xfd, 0x02, 0x7f, 0xe4, 0xf5, 0x3f, 0xf9,
+  0x33, 0xe7, 0x3f, 0xf8, 0x64, 0x1f, 0xfa, 0x9b, 0x7f, 0xf2, 0x9b, 0xff,
+  0x00, 0xdb, 0x68, 0xff, 0x00, 0x86, 0x41, 0xff, 0x00, 0xa9, 0xb7, 0xff,
+  0x00, 0x29, 0xbf, 0xfd, 0xb6, 0xbe, 0x8c, 0xa2, 0x8f, 0xf5, 0x27, 0x20,
+  0xff, 0x00, 0xa0, 0x7f, 0xfc, 0x9e, 0x7f, 0xfc, 0x90, 0x7f, 0xc4, 0x3a,
+  0xe1, 0x7f, 0xfa, 0x04, 0xff, 0x00, 0xc9, 0xea, 0x7f, 0xf2, 0x67, 0xce,
+  0x7f, 0xf0, 0xc8, 0x3f, 0xf5, 0x36, 0xff, 0x00, 0xe5, 0x37, 0xff, 0x00,
+  0xb6, 0xd1, 0xff, 0x00, 0x0c, 0x83, 0xff, 0x00, 0x53, 0x6f, 0xfe, 0x53,
+  0x7f, 0xfb, 0x6d, 0x7d, 0x19, 0x45, 0x1f, 0xea, 0x4e, 0x41, 0xff, 0x00,
+  0x40, 0xff, 0x00, 0xf9, 0x3c, 0xff, 0x00, 0xf9, 0x20, 0xff, 0x00, 0x88,
+  0x75, 0xc2, 0xff, 0x00, 0xf4, 0x09, 0xff, 0x00, 0x93, 0xd4, 0xff, 0x00,
+  0xe4, 0xcf, 0x9c, 0xff, 0x00, 0xe1, 0x90, 0x7f, 0xea, 0x6d, 0xff, 0x00,
+  0xca, 0x6f, 0xff, 0x00, 0x6d, 0xa3, 0xfe, 0x19, 0x07, 0xfe, 0xa6, 0xdf,
+  0xfc, 0xa6, 0xff, 0x00, 0xf6, 0xda, 0xfa, 0x32, 0x8a, 0x3f, 0xd4, 0x9c,
+  0x83, 0xfe, 0x81, 0xff, 0x00, 0xf2, 0x79, 0xff, 0x00, 0xf2, 0x41, 0xff,
+  0x00, 0x10, 0xeb, 0x85, 0xff, 0x00, 0xe8, 0x13, 0xff, 0x00, 0x27, 0xa9,
+  0xff, 0x00, 0xc9, 0x9f, 0x39, 0xff, 0x00, 0xc3, 0x20, 0xff, 0x00, 0xd4,
+  0xdb, 0xff, 0x00, 0x94, 0xdf, 0xfe, 0xdb, 0x47, 0xfc, 0x32, 0x0f, 0xfd,
+  0x4d, 0xbf, 0xf9, 0x4d, 0xff, 0x00, 0xed, 0xb5, 0xf4, 0x65, 0x14, 0x7f,
+  0xa9, 0x39, 0x07, 0xfd, 0x03, 0xff, 0x00, 0xe4, 0xf3, 0xff, 0x00, 0xe4,
+  0x83, 0xfe, 0x21, 0xd7, 0x0b, 0xff, 0x00, 0xd0, 0x27, 0xfe, 0x4f, 0x53,
+  0xff, 0x00, 0x93, 0x3e, 0x73, 0xff, 0x00, 0x86, 0x41, 0xff, 0x00, 0xa9,
+  0xb7, 0xff, 0x00, 0x29, 0xbf, 0xfd, 0xb6, 0x8f, 0xf8, 0x64, 0x1f, 0xfa,
+  0x9b, 0x7f, 0xf2, 0x9b, 0xff, 0x00, 0xdb, 0x6b, 0xe8, 0xca, 0x28, 0xff,
+  0x00, 0x52, 0x72, 0x0f, 0xfa, 0x07, 0xff, 0x00, 0xc9, 0xe7, 0xff, 0x00,
+  0xc9, 0x07, 0xfc, 0x43, 0xae, 0x17, 0xff, 0x00, 0xa0, 0x4f, 0xfc, 0x9e,
+  0xa7, 0xff, 0x00, 0x26, 0x7c, 0xe7, 0xff, 0x00, 0x0c, 0x83, 0xff, 0x00,
+  0x53, 0x6f, 0xfe, 0x53, 0x7f, 0xfb, 0x6d, 0x15, 0xf4, 0x65, 0x14, 0x7f,
+  0xa9, 0x39, 0x07, 0xfd, 0x03, 0xff, 0x00, 0xe4, 0xf3, 0xff, 0x00, 0xe4,
+  0x83, 0xfe, 0x21, 0xd7, 0x0b, 0xff, 0x00, 0xd0, 0x27, 0xfe, 0x4f, 0x53,
+  0xff, 0x00, 0x93, 0x3f, 0xff, 0xd9
+};
+
+// 63x45, quadrants red/green/blue/white
+const unsigned char ref_63x45_jpg[] = {
+  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43,
+  0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04,
+  0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07,
+  0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d,
+  0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10,
+  0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18, 0x16, 0x14,
+  0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03, 0x04,
+  0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x2d, 0x00, 0x3f, 0x03,
+  0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00,
+  0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00,
+  0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00,
+  0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+  0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81,
+  0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24,
+  0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25,
+  0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+  0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56,
+  0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a,
+  0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86,
+  0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+  0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3,
+  0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6,
+  0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9,
+  0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+  0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00,
+  0x1f, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+  0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00,
+  0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31,
+  0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08,
+  0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+  0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18,
+  0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39,
+  0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+  0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84,
+  0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+  0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa,
+  0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+  0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+  0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea,
+  0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda, 0x00,
+  0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf9,
+  0xd2, 0x8a, 0x28, 0xaf, 0xc3, 0x0f, 0xf5, 0x4c, 0x2b, 0x67, 0xc1, 0x9f,
+  0xf2, 0x38, 0x68, 0x5f, 0xf5, 0xff, 0x00, 0x07, 0xfe, 0x8c, 0x5a, 0xc6,
+  0xad, 0x9f, 0x06, 0x7f, 0xc8, 0xe1, 0xa1, 0x7f, 0xd7, 0xfc, 0x1f, 0xfa,
+  0x31, 0x6b, 0x1a, 0xff, 0x00, 0xc2, 0x9f, 0xa3, 0xfc, 0x8f, 0x98, 0xe2,
+  0x9f, 0xf9, 0x10, 0x63, 0xff, 0x00, 0xeb, 0xcd, 0x5f, 0xfd, 0x22, 0x47,
+  0xd5, 0xb4, 0x51, 0x45, 0x7e, 0x30, 0x7f, 0xcd, 0xb0, 0x51, 0x45, 0x14,
+  0x01, 0xf0, 0xd7, 0xfc, 0x27, 0x9a, 0x17, 0xfc, 0xff, 0x00, 0x7f, 0xe4,
+  0x19, 0x3f, 0xf8, 0x9a, 0x3f, 0xe1, 0x3c, 0xd0, 0xbf, 0xe7, 0xfb, 0xff,
+  0x00, 0x20, 0xc9, 0xff, 0x00, 0xc4, 0xd7, 0x90, 0xd1, 0x5f, 0xec, 0x4f,
+  0xfc, 0x4b, 0x8f, 0x09, 0xff, 0x00, 0xd0, 0x4e, 0x27, 0xff, 0x00, 0x03,
+  0xa5, 0xff, 0x00, 0xca, 0x4f, 0xf5, 0xe7, 0xfe, 0x23, 0xe7, 0x13, 0xff,
+  0x00, 0xd0, 0x3d, 0x0f, 0xfc, 0x06, 0xa7, 0xff, 0x00, 0x2d, 0x3d, 0x7b,
+  0xfe, 0x13, 0xcd, 0x0b, 0xfe, 0x7f, 0xbf, 0xf2, 0x0c, 0x9f, 0xfc, 0x4d,
+  0x74, 0xbf, 0x0c, 0x7c, 0x49, 0xa7, 0x78, 0x8b, 0xe2, 0x4f, 0x84, 0xf4,
+  0xad, 0x3e, 0xe3, 0xed, 0x17, 0xf7, 0xda, 0xb5, 0xa5, 0xad, 0xbc, 0x3b,
+  0x19, 0x77, 0xc8, 0xf3, 0x22, 0xa2, 0xe5, 0x80, 0x03, 0x24, 0x81, 0x92,
+  0x40, 0xaf, 0x9f, 0x2b, 0xd2, 0xff, 0x00, 0x66, 0x2f, 0xf9, 0x39, 0x4f,
+  0x84, 0xdf, 0xf6, 0x36, 0xe9, 0x3f, 0xfa, 0x59, 0x15, 0x79, 0xf9, 0x87,
+  0xd1, 0xd7, 0x85, 0x28, 0xe0, 0xeb, 0x55, 0x8e, 0x27, 0x11, 0x78, 0xc6,
+  0x4f, 0xe3, 0xa7, 0xd1, 0x3f, 0xfa, 0x74, 0x71, 0xe3, 0x7c, 0x6f, 0xe2,
+  0x3c, 0xcf, 0x0b, 0x57, 0x03, 0x5a, 0x85, 0x05, 0x1a, 0xb1, 0x70, 0x6d,
+  0x46, 0xa5, 0xed, 0x24, 0xd3, 0xb5, 0xea, 0x35, 0x7b, 0x3d, 0x2e, 0x9f,
+  0xa1, 0xfa, 0x7d, 0xff, 0x00, 0x0c, 0xf1, 0xf1, 0x07, 0xfe, 0x85, 0xff,
+  0x00, 0xfc, 0x9d, 0xb7, 0xff, 0x00, 0xe3, 0x94, 0x7f, 0xc3, 0x3c, 0x7c,
+  0x41, 0xff, 0x00, 0xa1, 0x7f, 0xff, 0x00, 0x27, 0x6d, 0xff, 0x00, 0xf8,
+  0xe5, 0x7d, 0xa5, 0x45, 0x7f, 0x09, 0x7f, 0xc4, 0x39, 0xca, 0x7f, 0xe7,
+  0xed, 0x4f, 0xbe, 0x3f, 0xfc, 0x81, 0xfc, 0x89, 0xff, 0x00, 0x10, 0x97,
+  0x23, 0xff, 0x00, 0x9f, 0xd5, 0x7f, 0xf0, 0x28, 0x7f, 0xf2, 0xb3, 0xe2,
+  0xdf, 0xf8, 0x67, 0x8f, 0x88, 0x3f, 0xf4, 0x2f, 0xff, 0x00, 0xe4, 0xed,
+  0xbf, 0xff, 0x00, 0x1c, 0xa3, 0xfe, 0x19, 0xe3, 0xe2, 0x0f, 0xfd, 0x0b,
+  0xff, 0x00, 0xf9, 0x3b, 0x6f, 0xff, 0x00, 0xc7, 0x2b, 0xed, 0x2a, 0x28,
+  0xff, 0x00, 0x88, 0x73, 0x94, 0xff, 0x00, 0xcf, 0xda, 0x9f, 0x7c, 0x7f,
+  0xf9, 0x00, 0xff, 0x00, 0x88, 0x4b, 0x91, 0xff, 0x00, 0xcf, 0xea, 0xbf,
+  0xf8, 0x14, 0x3f, 0xf9, 0x59, 0xfc, 0xd2, 0x51, 0x45, 0x15, 0xfe, 0xd3,
+  0x9f, 0x66, 0x15, 0xe9, 0x7f, 0xb3, 0x17, 0xfc, 0x9c, 0xa7, 0xc2, 0x6f,
+  0xfb, 0x1b, 0x74, 0x9f, 0xfd, 0x2c, 0x8a, 0xbc, 0xd2, 0xbd, 0x2f, 0xf6,
+  0x62, 0xff, 0x00, 0x93, 0x94, 0xf8, 0x4d, 0xff, 0x00, 0x63, 0x6e, 0x93,
+  0xff, 0x00, 0xa5, 0x91, 0x57, 0x95, 0x9b, 0x7f, 0xc8, 0xbf, 0x11, 0xfe,
+  0x09, 0x7f, 0xe9, 0x2c, 0xd2, 0x9f, 0xc6, 0xbd, 0x4f, 0xe8, 0x42, 0x8a,
+  0x28, 0xaf, 0xf3, 0x04, 0xfb, 0x40, 0xa2, 0x8a, 0x28, 0x03, 0xff, 0xd9
+};
+
+// 50x33, quadrants red/green/blue/white
+const unsigned char ref_50x33_jpg[] = {
+  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43,
+  0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04,
+  0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07,
+  0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d,
+  0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10,
+  0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18, 0x16, 0x14,
+  0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03, 0x04,
+  0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x21, 0x00, 0x32, 0x03,
+  0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00,
+  0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00,
+  0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00,
+  0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+  0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81,
+  0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24,
+  0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25,
+  0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+  0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56,
+  0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a,
+  0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86,
+  0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+  0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3,
+  0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6,
+  0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9,
+  0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+  0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00,
+  0x1f, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+  0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00,
+  0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31,
+  0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08,
+  0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+  0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18,
+  0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39,
+  0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+  0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84,
+  0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+  0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa,
+  0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+  0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+  0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea,
+  0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda, 0x00,
+  0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf9,
+  0xd2, 0xbf, 0x0c, 0x3f, 0xd5, 0x30, 0xa0, 0x02, 0x80, 0x3e, 0xad, 0xf0,
+  0x67, 0xfc, 0x89, 0xfa, 0x17, 0xfd, 0x78, 0x41, 0xff, 0x00, 0xa2, 0xd6,
+  0xbf, 0x20, 0xc7, 0x7f, 0xbd, 0xd5, 0xff, 0x00, 0x14, 0xbf, 0x36, 0x7f,
+  0xce, 0xef, 0x8a, 0x3f, 0xf2, 0x5e, 0xe7, 0xff, 0x00, 0xf6, 0x19, 0x89,
+  0xff, 0x00, 0xd3, 0xd3, 0x36, 0x6b, 0x84, 0xfc, 0xc4, 0x28, 0x00, 0xa0,
+  0x0f, 0x8e, 0x6b, 0xf6, 0xd3, 0xfe, 0x9c, 0x02, 0x80, 0x0a, 0x00, 0xfa,
+  0xb7, 0xc1, 0x9f, 0xf2, 0x27, 0xe8, 0x5f, 0xf5, 0xe1, 0x07, 0xfe, 0x8b,
+  0x5a, 0xfc, 0x83, 0x1d, 0xfe, 0xf7, 0x57, 0xfc, 0x52, 0xfc, 0xd9, 0xff,
+  0x00, 0x3b, 0xbe, 0x28, 0xff, 0x00, 0xc9, 0x7b, 0x9f, 0xff, 0x00, 0xd8,
+  0x66, 0x27, 0xff, 0x00, 0x4f, 0x4c, 0xd9, 0xae, 0x13, 0xf3, 0x10, 0xa0,
+  0x02, 0x80, 0x3f, 0x2f, 0x2b, 0xfe, 0x8c, 0xcf, 0xee, 0x50, 0xa0, 0x02,
+  0x80, 0x3f, 0xa0, 0xff, 0x00, 0xd9, 0x8b, 0xfe, 0x4d, 0xaf, 0xe1, 0x37,
+  0xfd, 0x8a, 0x5a, 0x4f, 0xfe, 0x91, 0xc5, 0x5f, 0xe6, 0xb7, 0x16, 0x7f,
+  0xc9, 0x43, 0x98, 0xff, 0x00, 0xd7, 0xea, 0xbf, 0xfa, 0x5c, 0x8f, 0xb1,
+  0xa1, 0xfc, 0x18, 0x7a, 0x2f, 0xc8, 0xf4, 0xca, 0xf9, 0x53, 0x70, 0xa0,
+  0x02, 0x80, 0x3f, 0x9a, 0x4a, 0xff, 0x00, 0x54, 0xcf, 0x87, 0x0a, 0x00,
+  0x28, 0x03, 0xfa, 0x0f, 0xfd, 0x98, 0xbf, 0xe4, 0xda, 0xfe, 0x13, 0x7f,
+  0xd8, 0xa5, 0xa4, 0xff, 0x00, 0xe9, 0x1c, 0x55, 0xfe, 0x6b, 0x71, 0x67,
+  0xfc, 0x94, 0x39, 0x8f, 0xfd, 0x7e, 0xab, 0xff, 0x00, 0xa5, 0xc8, 0xfb,
+  0x1a, 0x1f, 0xc1, 0x87, 0xa2, 0xfc, 0x8f, 0x4c, 0xaf, 0x95, 0x37, 0x0a,
+  0x00, 0x28, 0x03, 0xf9, 0xa4, 0xaf, 0xf5, 0x4c, 0xf8, 0x70, 0xa0, 0x02,
+  0x80, 0x3f, 0xa0, 0xff, 0x00, 0xd9, 0x8b, 0xfe, 0x4d, 0xaf, 0xe1, 0x37,
+  0xfd, 0x8a, 0x5a, 0x4f, 0xfe, 0x91, 0xc5, 0x5f, 0xe6, 0xb7, 0x16, 0x7f,
+  0xc9, 0x43, 0x98, 0xff, 0x00, 0xd7, 0xea, 0xbf, 0xfa, 0x5c, 0x8f, 0xb1,
+  0xa1, 0xfc, 0x18, 0x7a, 0x2f, 0xc8, 0xf4, 0xca, 0xf9, 0x53, 0x70, 0xa0,
+  0x02, 0x80, 0x3f, 0xff, 0xd9
+};
+
+// 17x9, quadrants red/green/blue/white
+const unsigned char ref_17x9_jpg[] = {
+  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43,
+  0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04,
+  0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07,
+  0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d,
+  0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10,
+  0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18, 0x16, 0x14,
+  0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03, 0x04,
+  0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x09, 0x00, 0x11, 0x03,
+  0x01, 0x21, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00,
+  0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00,
+  0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00,
+  0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+  0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81,
+  0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24,
+  0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25,
+  0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+  0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56,
+  0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a,
+  0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86,
+  0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+  0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3,
+  0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6,
+  0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9,
+  0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+  0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00,
+  0x1f, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+  0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00,
+  0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31,
+  0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08,
+  0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+  0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18,
+  0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39,
+  0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+  0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84,
+  0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+  0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa,
+  0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+  0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+  0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea,
+  0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda, 0x00,
+  0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf8,
+  0xdb, 0xfe, 0x16, 0xaf, 0xfd, 0x42, 0xff, 0x00, 0xf2, 0x63, 0xff, 0x00,
+  0xb1, 0xaf, 0xd9, 0x0f, 0xf8, 0x64, 0x1f, 0xfa, 0x9b, 0x7f, 0xf2, 0x9b,
+  0xff, 0x00, 0xdb, 0x68, 0xf1, 0x33, 0xc0, 0xcf, 0xf5, 0x73, 0xea, 0x7f,
+  0xf0, 0xa5, 0xed, 0x3d, 0xa7, 0xb4, 0xff, 0x00, 0x97, 0x5c, 0xb6, 0xe5,
+  0xe4, 0xff, 0x00, 0xa7, 0xae, 0xf7, 0xb8, 0xbc, 0x61, 0xcc, 0xff, 0x00,
+  0xe2, 0x34, 0xfd, 0x43, 0xdc, 0xfa, 0xa7, 0xd5, 0x3d, 0xaf, 0x5f, 0x6b,
+  0xcf, 0xed, 0x7d, 0x9f, 0x95, 0x3e, 0x5e, 0x5f, 0x67, 0xe7, 0x7b, 0xf4,
+  0xb6, 0xa7, 0xfc, 0x32, 0x0f, 0xfd, 0x4d, 0xbf, 0xf9, 0x4d, 0xff, 0x00,
+  0xed, 0xb4, 0x57, 0xe1, 0xff, 0x00, 0xf1, 0x0c, 0xff, 0x00, 0xea, 0x33,
+  0xff, 0x00, 0x29, 0xff, 0x00, 0xf6, 0xe7, 0xf3, 0x8f, 0xfc, 0x41, 0xef,
+  0xfa, 0x8f, 0xff, 0x00, 0xca, 0x5f, 0xfd, 0xd0, 0xfc, 0x30, 0xaf, 0xe9,
+  0x6e, 0xbf, 0xd1, 0x9f, 0x1c, 0xff, 0x00, 0xe6, 0x5b, 0xff, 0x00, 0x71,
+  0x7f, 0xf7, 0x11, 0xfb, 0x9e, 0x59, 0xf6, 0xfe, 0x5f, 0xa8, 0x51, 0x5f,
+  0xca, 0xc7, 0xb8, 0x7f, 0xff, 0xd9
+};
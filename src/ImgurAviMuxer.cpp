@@ -0,0 +1,147 @@
+/*
+
+  Imgur Image Upload library for ESP32
+
+  Streaming MJPEG AVI muxer: JPEG frames are wrapped in RIFF chunks as they
+  come, the idx1 index is built from the frame sizes and written at the end.
+
+  MIT License
+
+  Copyright (c) 2019 tobozo
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include "ImgurAviMuxer.h"
+
+#define AVI_SIZES_GROWTH 64      // index entries allocated at once
+#define AVIF_HASINDEX    0x10
+#define AVIIF_KEYFRAME   0x10
+
+
+ImgurAviMuxer::ImgurAviMuxer( Print &out ) : out(out), sizes(NULL), frameCount(0), capacity(0), frameLen(0), failed(false) { ; }
+
+
+ImgurAviMuxer::~ImgurAviMuxer() {
+  free( sizes );
+}
+
+
+bool ImgurAviMuxer::put( const void* data, size_t len ) {
+  if( !failed && out.write( (const uint8_t*)data, len ) != len ) failed = true;
+  return !failed;
+}
+
+
+bool ImgurAviMuxer::put32( uint32_t v ) {
+  uint8_t b[4] = { (uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24) };
+  return put( b, 4 );
+}
+
+
+bool ImgurAviMuxer::begin( uint16_t width, uint16_t height, uint8_t fps, uint32_t frames, size_t framesSize ) {
+  uint32_t riffSize = framesSize > 0 ? fileSize( framesSize ) - 8 : 0;
+  uint32_t moviSize = framesSize > 0 ? 4 + framesSize - 16 * frames : 0;
+  put( "RIFF", 4 ); put32( riffSize ); put( "AVI ", 4 );
+  put( "LIST", 4 ); put32( 192 ); put( "hdrl", 4 );
+  // main header
+  put( "avih", 4 ); put32( 56 );
+  put32( 1000000 / fps );        // us per frame
+  put32( 0 );                    // max bytes per second
+  put32( 0 );                    // padding granularity
+  put32( AVIF_HASINDEX );
+  put32( frames );
+  put32( 0 );                    // initial frames
+  put32( 1 );                    // streams
+  put32( 0 );                    // suggested buffer size
+  put32( width );
+  put32( height );
+  put32( 0 ); put32( 0 ); put32( 0 ); put32( 0 );
+  // video stream header
+  put( "LIST", 4 ); put32( 116 ); put( "strl", 4 );
+  put( "strh", 4 ); put32( 56 );
+  put( "vids", 4 ); put( "MJPG", 4 );
+  put32( 0 );                    // flags
+  put32( 0 );                    // priority, language
+  put32( 0 );                    // initial frames
+  put32( 1 );                    // scale
+  put32( fps );                  // rate, frames per second is rate/scale
+  put32( 0 );                    // start
+  put32( frames );               // length
+  put32( 0 );                    // suggested buffer size
+  put32( 0xFFFFFFFF );           // quality
+  put32( 0 );                    // sample size
+  put32( 0 );                    // frame rectangle left, top
+  put32( width | ( (uint32_t)height << 16 ) ); // right, bottom
+  // BITMAPINFOHEADER
+  put( "strf", 4 ); put32( 40 );
+  put32( 40 );
+  put32( width );
+  put32( height );
+  put32( 1 | ( 24 << 16 ) );     // planes, bit count
+  put( "MJPG", 4 );
+  put32( (uint32_t)width * height * 3 );
+  put32( 0 ); put32( 0 ); put32( 0 ); put32( 0 );
+  put( "LIST", 4 ); put32( moviSize ); put( "movi", 4 );
+  return !failed;
+}
+
+
+bool ImgurAviMuxer::beginFrame( size_t len ) {
+  if( frameCount == capacity ) {
+    uint32_t* grown = (uint32_t*)realloc( sizes, ( capacity + AVI_SIZES_GROWTH ) * sizeof(uint32_t) );
+    if( grown == NULL ) {
+      log_e("Can't grow the AVI index past %d frames", frameCount);
+      failed = true;
+      return false;
+    }
+    sizes = grown;
+    capacity += AVI_SIZES_GROWTH;
+  }
+  sizes[frameCount++] = len;
+  frameLen = len;
+  put( "00dc", 4 );
+  return put32( len );
+}
+
+
+bool ImgurAviMuxer::endFrame() {
+  // chunks are word aligned
+  if( frameLen & 1 ) put( "", 1 );
+  return !failed;
+}
+
+
+bool ImgurAviMuxer::end() {
+  put( "idx1", 4 );
+  put32( frameCount * 16 );
+  uint32_t offset = 4; // from the "movi" fourcc
+  for( uint32_t i=0; i<frameCount && !failed; i++ ) {
+    put( "00dc", 4 );
+    put32( AVIIF_KEYFRAME );
+    put32( offset );
+    put32( sizes[i] );
+    offset += 8 + sizes[i] + ( sizes[i] & 1 );
+  }
+  free( sizes );
+  sizes = NULL;
+  capacity = 0;
+  return !failed && frameCount > 0;
+}
@@ -0,0 +1,66 @@
+/*
+
+  Imgur Image Upload library for ESP32
+
+  Streaming MJPEG AVI muxer: JPEG frames are wrapped in RIFF chunks as they
+  come, the idx1 index is built from the frame sizes and written at the end.
+
+  MIT License
+
+  Copyright (c) 2019 tobozo
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef imgur_avi_muxer_h
+#define imgur_avi_muxer_h
+
+#include <Arduino.h>
+
+
+// begin(), then beginFrame( len ) + len JPEG bytes + endFrame() for each frame, then end()
+class ImgurAviMuxer {
+  public:
+    static const size_t HEADER_SIZE = 224; // RIFF + hdrl + movi list headers
+    // bytes added to the file by a frame of len bytes, its chunk and its index entry
+    static size_t frameSize( size_t len ) { return 8 + len + ( len & 1 ) + 16; }
+    // size of a file made of frames totalling framesSize (sum of frameSize())
+    static size_t fileSize( size_t framesSize ) { return HEADER_SIZE + framesSize + 8; }
+
+    ImgurAviMuxer( Print &out );
+    ~ImgurAviMuxer();
+    // frames=0 and framesSize=0 when unknown (streamed), the headers then say 0 and readers rely on the index
+    bool   begin( uint16_t width, uint16_t height, uint8_t fps, uint32_t frames=0, size_t framesSize=0 );
+    bool   beginFrame( size_t len );
+    bool   endFrame();
+    bool   end();
+    uint32_t frames() { return frameCount; }
+  private:
+    bool     put( const void* data, size_t len );
+    bool     put32( uint32_t v );
+    Print   &out;
+    uint32_t*sizes;      // frame lengths, the index is derived from them
+    uint32_t frameCount;
+    uint32_t capacity;
+    size_t   frameLen;
+    bool     failed;
+};
+
+#endif
@@ -0,0 +1,220 @@
+/*
+
+  Imgur Image Upload library for ESP32
+
+  Streaming animated GIF encoder: frames come row by row, are mapped to a
+  fixed 6x7x6 color cube with ordered dithering and LZW compressed on the fly.
+
+  MIT License
+
+  Copyright (c) 2019 tobozo
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include "ImgurGifEncoder.h"
+
+#define GIF_HASH_SIZE  5003 // prime, 80% occupancy at 4096 codes
+#define GIF_CLEAR_CODE 256
+#define GIF_EOI_CODE   257
+#define GIF_MAX_CODE   4096
+
+// 6 red x 7 green x 6 blue levels
+#define GIF_RED_LEVELS   6
+#define GIF_GREEN_LEVELS 7
+#define GIF_BLUE_LEVELS  6
+
+static const uint8_t bayer4[4][4] = {
+  {  0,  8,  2, 10 },
+  { 12,  4, 14,  6 },
+  {  3, 11,  1,  9 },
+  { 15,  7, 13,  5 }
+};
+
+
+// ordered dithering: floor( v*(levels-1)/255 + threshold/16 )
+static inline uint8_t ditherLevel( uint8_t v, uint8_t levels, uint8_t threshold ) {
+  uint32_t level = ( (uint32_t)v * ( levels - 1 ) * 16 + threshold * 255 ) / ( 255 * 16 );
+  return level >= levels ? levels - 1 : level;
+}
+
+
+ImgurGifEncoder::ImgurGifEncoder( Print &out, uint16_t frameDelayMs ) : out(out), delay( ( frameDelayMs + 5 ) / 10 ), canvasWidth(0), canvasHeight(0), frameCount(0), hashKeys(NULL), hashCodes(NULL), failed(false) { ; }
+
+
+ImgurGifEncoder::~ImgurGifEncoder() {
+  release();
+}
+
+
+void ImgurGifEncoder::release() {
+  free( hashKeys );
+  free( hashCodes );
+  hashKeys  = NULL;
+  hashCodes = NULL;
+}
+
+
+bool ImgurGifEncoder::beginImage( uint16_t width, uint16_t height ) {
+  if( failed ) return false;
+  if( canvasWidth == 0 ) {
+    hashKeys  = (int32_t*)malloc( GIF_HASH_SIZE * sizeof(int32_t) );
+    hashCodes = (uint16_t*)malloc( GIF_HASH_SIZE * sizeof(uint16_t) );
+    if( hashKeys == NULL || hashCodes == NULL ) {
+      log_e("Can't alloc GIF encoder tables");
+      release();
+      failed = true;
+      return false;
+    }
+    canvasWidth  = width;
+    canvasHeight = height;
+    // header, logical screen with a 256 colors global table
+    const uint8_t screen[] = { 'G','I','F','8','9','a', (uint8_t)width,(uint8_t)(width>>8), (uint8_t)height,(uint8_t)(height>>8), 0xF7, 0, 0 };
+    out.write( screen, sizeof(screen) );
+    for( uint16_t i=0; i<256; i++ ) {
+      uint8_t rgb[3] = { 0, 0, 0 };
+      if( i < GIF_RED_LEVELS * GIF_GREEN_LEVELS * GIF_BLUE_LEVELS ) {
+        rgb[0] = ( i / ( GIF_GREEN_LEVELS * GIF_BLUE_LEVELS ) ) * 255 / ( GIF_RED_LEVELS - 1 );
+        rgb[1] = ( ( i / GIF_BLUE_LEVELS ) % GIF_GREEN_LEVELS ) * 255 / ( GIF_GREEN_LEVELS - 1 );
+        rgb[2] = ( i % GIF_BLUE_LEVELS ) * 255 / ( GIF_BLUE_LEVELS - 1 );
+      }
+      out.write( rgb, 3 );
+    }
+    // loop forever
+    static const uint8_t netscape[] = { 0x21,0xFF,11, 'N','E','T','S','C','A','P','E','2','.','0', 3,1,0,0, 0 };
+    out.write( netscape, sizeof(netscape) );
+  }
+  frameWidth  = width  < canvasWidth  ? width  : canvasWidth;
+  frameHeight = height < canvasHeight ? height : canvasHeight;
+  row = 0;
+  // graphic control extension (frame delay) + image descriptor + LZW minimum code size
+  const uint8_t frame[] = {
+    0x21,0xF9,4, 0x04, (uint8_t)delay,(uint8_t)(delay>>8), 0, 0,
+    0x2C, 0,0, 0,0, (uint8_t)frameWidth,(uint8_t)(frameWidth>>8), (uint8_t)frameHeight,(uint8_t)(frameHeight>>8), 0,
+    8
+  };
+  if( out.write( frame, sizeof(frame) ) != sizeof(frame) ) failed = true;
+  block[0] = 0;
+  bitBuf   = 0;
+  bitCnt   = 0;
+  prefix   = -1;
+  resetTable();
+  writeCode( GIF_CLEAR_CODE );
+  return !failed;
+}
+
+
+void ImgurGifEncoder::resetTable() {
+  memset( hashKeys, 0, GIF_HASH_SIZE * sizeof(int32_t) );
+  nextCode = GIF_EOI_CODE + 1;
+  codeSize = 9;
+}
+
+
+bool ImgurGifEncoder::writeRow( const uint8_t* rgb888 ) {
+  if( failed || row >= frameHeight ) return !failed;
+  for( uint16_t x=0; x<frameWidth; x++ ) {
+    const uint8_t* p = rgb888 + x*3;
+    uint8_t threshold = bayer4[row & 3][x & 3];
+    uint8_t r = ditherLevel( p[0], GIF_RED_LEVELS,   threshold );
+    uint8_t g = ditherLevel( p[1], GIF_GREEN_LEVELS, threshold );
+    uint8_t b = ditherLevel( p[2], GIF_BLUE_LEVELS,  threshold );
+    encodePixel( ( r * GIF_GREEN_LEVELS + g ) * GIF_BLUE_LEVELS + b );
+  }
+  row++;
+  return !failed;
+}
+
+
+void ImgurGifEncoder::encodePixel( uint8_t index ) {
+  if( prefix < 0 ) {
+    prefix = index;
+    return;
+  }
+  int32_t key = ( ( prefix << 8 ) | index ) + 1;
+  uint32_t slot = (uint32_t)key % GIF_HASH_SIZE;
+  while( hashKeys[slot] != 0 ) {
+    if( hashKeys[slot] == key ) {
+      prefix = hashCodes[slot]; // the string goes on
+      return;
+    }
+    if( ++slot == GIF_HASH_SIZE ) slot = 0;
+  }
+  writeCode( prefix );
+  hashKeys[slot]  = key;
+  hashCodes[slot] = nextCode++;
+  // the decoder adds its entries one code late, hence the ">"
+  if( nextCode > ( 1 << codeSize ) && codeSize < 12 ) codeSize++;
+  if( nextCode == GIF_MAX_CODE ) {
+    writeCode( GIF_CLEAR_CODE );
+    resetTable();
+  }
+  prefix = index;
+}
+
+
+void ImgurGifEncoder::writeCode( uint16_t code ) {
+  bitBuf |= (uint32_t)code << bitCnt;
+  bitCnt += codeSize;
+  while( bitCnt >= 8 ) {
+    putByte( bitBuf & 0xFF );
+    bitBuf >>= 8;
+    bitCnt -= 8;
+  }
+}
+
+
+void ImgurGifEncoder::putByte( uint8_t c ) {
+  block[ ++block[0] ] = c;
+  if( block[0] == 255 ) flushBlock();
+}
+
+
+bool ImgurGifEncoder::flushBlock() {
+  if( block[0] > 0 ) {
+    size_t len = block[0] + 1;
+    if( out.write( block, len ) != len ) failed = true;
+    block[0] = 0;
+  }
+  return !failed;
+}
+
+
+bool ImgurGifEncoder::endImage() {
+  if( failed ) return false;
+  if( prefix >= 0 ) writeCode( prefix );
+  writeCode( GIF_EOI_CODE );
+  if( bitCnt > 0 ) putByte( bitBuf & 0xFF );
+  bitBuf = 0;
+  bitCnt = 0;
+  flushBlock();
+  uint8_t terminator = 0;
+  if( out.write( &terminator, 1 ) != 1 ) failed = true;
+  bool complete = row == frameHeight;
+  if( !failed && complete ) frameCount++;
+  return !failed && complete;
+}
+
+
+bool ImgurGifEncoder::finish() {
+  release();
+  uint8_t trailer = 0x3B;
+  return !failed && frameCount > 0 && out.write( &trailer, 1 ) == 1;
+}
@@ -0,0 +1,71 @@
+/*
+
+  Imgur Image Upload library for ESP32
+
+  Streaming animated GIF encoder: frames come row by row, are mapped to a
+  fixed 6x7x6 color cube with ordered dithering and LZW compressed on the fly.
+
+  MIT License
+
+  Copyright (c) 2019 tobozo
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef imgur_gif_encoder_h
+#define imgur_gif_encoder_h
+
+#include "ImgurImage.h"
+
+
+// each beginImage()/writeRow()/endImage() sequence adds a frame, finish() closes the file
+class ImgurGifEncoder : public ImgurRowSink {
+  public:
+    // the first frame sets the canvas size, bigger frames are cropped
+    ImgurGifEncoder( Print &out, uint16_t frameDelayMs );
+    ~ImgurGifEncoder();
+    bool beginImage( uint16_t width, uint16_t height );
+    bool writeRow( const uint8_t* rgb888 );
+    bool endImage();
+    bool finish();
+    uint16_t frames() { return frameCount; }
+  private:
+    void     release();
+    void     putByte( uint8_t c );
+    bool     flushBlock();
+    void     writeCode( uint16_t code );
+    void     resetTable();
+    void     encodePixel( uint8_t index );
+    Print   &out;
+    uint16_t delay;      // 1/100 s
+    uint16_t canvasWidth, canvasHeight;
+    uint16_t frameWidth, frameHeight, row, frameCount;
+    int32_t *hashKeys;   // (prefix << 8 | pixel) + 1, 0 for empty slots
+    uint16_t*hashCodes;
+    int32_t  prefix;     // current string code, -1 when empty
+    uint16_t nextCode;
+    uint8_t  codeSize;
+    uint32_t bitBuf;
+    uint8_t  bitCnt;
+    uint8_t  block[256]; // [0] is the sub-block length
+    bool     failed;
+};
+
+#endif
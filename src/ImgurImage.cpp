@@ -0,0 +1,557 @@
+/*
+
+  Imgur Image Upload library for ESP32
+
+  Row based image pipeline: decoders push RGB888 rows into chained sinks
+  (resizer, encoders...) so whole frames never have to fit in RAM.
+
+  MIT License
+
+  Copyright (c) 2019 tobozo
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include "ImgurImage.h"
+
+#if __has_include(<rom/tjpgd.h>)
+  #include <rom/tjpgd.h>
+  #define IMGUR_HAS_TJPGD
+#elif __has_include(<esp32/rom/tjpgd.h>)
+  #include <esp32/rom/tjpgd.h>
+  #define IMGUR_HAS_TJPGD
+#endif
+
+#define IMGUR_TJPGD_WORKSIZE 3100 // recommended tjpgd work area
+
+
+ImgurResizer::ImgurResizer( uint16_t maxDimension, ImgurRowSink &next ) : maxDimension(maxDimension), next(next), acc(NULL), row(NULL) { ; }
+
+
+ImgurResizer::~ImgurResizer() {
+  release();
+}
+
+
+void ImgurResizer::release() {
+  free( acc );
+  free( row );
+  acc = NULL;
+  row = NULL;
+}
+
+
+bool ImgurResizer::beginImage( uint16_t width, uint16_t height ) {
+  inWidth   = width;
+  inHeight  = height;
+  outWidth  = width;
+  outHeight = height;
+  uint16_t largest = width > height ? width : height;
+  if( maxDimension > 0 && largest > maxDimension ) {
+    outWidth  = ( (uint32_t)width  * maxDimension ) / largest;
+    outHeight = ( (uint32_t)height * maxDimension ) / largest;
+    if( outWidth  == 0 ) outWidth  = 1;
+    if( outHeight == 0 ) outHeight = 1;
+  }
+  inRow   = 0;
+  outRow  = 0;
+  accRows = 0;
+  release();
+  acc = (uint32_t*)calloc( outWidth * 3, sizeof(uint32_t) );
+  row = (uint8_t*)malloc( outWidth * 3 );
+  if( acc == NULL || row == NULL ) {
+    log_e("Can't alloc resizer rows (%d pixels)", outWidth);
+    release();
+    return false;
+  }
+  log_d("Resizing %dx%d to %dx%d", inWidth, inHeight, outWidth, outHeight);
+  return next.beginImage( outWidth, outHeight );
+}
+
+
+bool ImgurResizer::writeRow( const uint8_t* rgb888 ) {
+  if( outRow >= outHeight ) return true; // rounding leftovers
+  // horizontal box filter, accumulated into the vertical sums
+  for( uint16_t x=0; x<outWidth; x++ ) {
+    uint16_t x0 = ( (uint32_t)x * inWidth ) / outWidth;
+    uint16_t x1 = ( (uint32_t)(x+1) * inWidth ) / outWidth;
+    uint32_t r = 0, g = 0, b = 0;
+    for( uint16_t sx=x0; sx<x1; sx++ ) {
+      r += rgb888[sx*3];
+      g += rgb888[sx*3+1];
+      b += rgb888[sx*3+2];
+    }
+    uint16_t n = x1 - x0;
+    acc[x*3]   += r / n;
+    acc[x*3+1] += g / n;
+    acc[x*3+2] += b / n;
+  }
+  accRows++;
+  inRow++;
+  // emit the output row once all the input rows it covers were summed
+  if( inRow < ( (uint32_t)(outRow+1) * inHeight ) / outHeight ) return true;
+  for( uint16_t i=0; i<outWidth*3; i++ ) {
+    row[i] = acc[i] / accRows;
+    acc[i] = 0;
+  }
+  accRows = 0;
+  outRow++;
+  return next.writeRow( row );
+}
+
+
+bool ImgurResizer::endImage() {
+  release();
+  return outRow == outHeight && next.endImage();
+}
+
+
+bool ImgurImageSignature::beginImage( uint16_t width, uint16_t height ) {
+  this->width  = width;
+  this->height = height;
+  row          = 0;
+  cellRow      = 0;
+  cellRowStart = 0;
+  valid        = false;
+  memset( sums, 0, sizeof(sums) );
+  memset( cells, 0, sizeof(cells) );
+  return width > 0 && height > 0;
+}
+
+
+bool ImgurImageSignature::writeRow( const uint8_t* rgb888 ) {
+  if( row >= height ) return false;
+  if( ( (uint32_t)row * GRID ) / height != cellRow ) closeCellRow();
+  for( uint16_t x=0; x<width; x++ ) {
+    const uint8_t* p = rgb888 + x*3;
+    sums[ ( (uint32_t)x * GRID ) / width ] += ( 77*p[0] + 150*p[1] + 29*p[2] ) >> 8;
+  }
+  row++;
+  return true;
+}
+
+
+void ImgurImageSignature::closeCellRow() {
+  uint16_t rows = row - cellRowStart;
+  for( uint8_t c=0; c<GRID; c++ ) {
+    uint16_t x0 = ( (uint32_t)c * width + GRID - 1 ) / GRID;     // first x with x*GRID/width == c
+    uint16_t x1 = ( (uint32_t)(c+1) * width + GRID - 1 ) / GRID;
+    uint32_t pixels = (uint32_t)( x1 - x0 ) * rows;
+    cells[cellRow*GRID + c] = pixels ? sums[c] / pixels : 0;
+    sums[c] = 0;
+  }
+  cellRow = ( (uint32_t)row * GRID ) / height;
+  cellRowStart = row;
+}
+
+
+bool ImgurImageSignature::endImage() {
+  if( row != height ) return false;
+  closeCellRow();
+  valid = true;
+  return true;
+}
+
+
+uint16_t ImgurImageSignature::distance( const ImgurImageSignature &other, uint8_t cellDelta ) const {
+  if( !valid || !other.valid ) return GRID*GRID;
+  uint16_t changed = 0;
+  for( uint16_t i=0; i<GRID*GRID; i++ ) {
+    int delta = (int)cells[i] - other.cells[i];
+    if( delta > cellDelta || -delta > cellDelta ) changed++;
+  }
+  return changed;
+}
+
+
+static uint32_t le32( const uint8_t* p ) { return p[0] | ( p[1] << 8 ) | ( p[2] << 16 ) | ( (uint32_t)p[3] << 24 ); }
+static uint16_t le16( const uint8_t* p ) { return p[0] | ( p[1] << 8 ); }
+
+
+ImgurJpegStripper::ImgurJpegStripper( uint8_t keep, Print* out ) : keep(keep), out(out), state(STATE_MARKER), headLen(0), remaining(0), keepSegment(true), exifLen(0), written(0), failed(false) { ; }
+
+
+size_t ImgurJpegStripper::write( uint8_t c ) {
+  return write( &c, 1 );
+}
+
+
+size_t ImgurJpegStripper::write( const uint8_t* data, size_t len ) {
+  size_t accepted = len;
+  while( len > 0 && !failed ) {
+    switch( state ) {
+      case STATE_PASS:
+        emit( data, len );
+        len = 0;
+      break;
+      case STATE_SEGMENT:
+      case STATE_EXIF:
+        {
+          size_t n = len < remaining ? len : remaining;
+          if( state == STATE_EXIF ) {
+            size_t room = sizeof(exif) - exifLen;
+            memcpy( exif + exifLen, data, n < room ? n : room );
+            exifLen += n < room ? n : room;
+          } else if( keepSegment ) {
+            emit( data, n );
+          }
+          data += n;
+          len -= n;
+          remaining -= n;
+          if( remaining == 0 ) {
+            if( state == STATE_EXIF ) emitOrientation();
+            state = head[1] == 0xDA ? STATE_PASS : STATE_MARKER; // entropy coded data follows SOS
+          }
+        }
+      break;
+      case STATE_MARKER:
+        {
+          uint8_t b = *data++;
+          len--;
+          if( headLen == 0 ) {
+            if( b != 0xFF ) {
+              // not a marker, this isn't a JPEG we understand: stop filtering
+              state = STATE_PASS;
+              emit( &b, 1 );
+              break;
+            }
+            head[headLen++] = b;
+            break;
+          }
+          if( b == 0xFF ) break; // fill byte
+          head[headLen++] = b;
+          if( b == 0xD8 || b == 0x01 || ( b >= 0xD0 && b <= 0xD7 ) ) {
+            // standalone markers
+            emit( head, 2 );
+            headLen = 0;
+          } else if( b == 0xD9 ) {
+            emit( head, 2 );
+            state = STATE_PASS;
+          } else {
+            state = STATE_LENGTH;
+          }
+        }
+      break;
+      case STATE_LENGTH:
+        {
+          head[headLen++] = *data++;
+          len--;
+          if( headLen < 4 ) break;
+          uint8_t marker = head[1];
+          uint16_t length = ( head[2] << 8 ) | head[3];
+          remaining = length > 2 ? length - 2 : 0;
+          headLen = 0;
+          // APP0 (JFIF) and APP14 (Adobe color transform) are needed to decode properly
+          keepSegment = !( ( marker >= 0xE1 && marker <= 0xEF && marker != 0xEE ) || marker == 0xFE );
+          if( marker == 0xE2 && ( keep & KEEP_ICC ) ) keepSegment = true;
+          if( marker == 0xE1 && ( keep & KEEP_ORIENTATION ) ) {
+            exifLen = 0;
+            state = STATE_EXIF;
+          } else {
+            state = STATE_SEGMENT;
+          }
+          if( keepSegment ) emit( head, 4 );
+          if( remaining == 0 ) state = marker == 0xDA ? STATE_PASS : STATE_MARKER;
+        }
+      break;
+    }
+  }
+  return failed ? 0 : accepted;
+}
+
+
+bool ImgurJpegStripper::emit( const uint8_t* data, size_t len ) {
+  if( out && out->write( data, len ) != len ) failed = true;
+  written += len;
+  return !failed;
+}
+
+
+// looks for the orientation tag in IFD0 and writes a minimal EXIF segment holding only that tag
+void ImgurJpegStripper::emitOrientation() {
+  if( exifLen < 14 || memcmp( exif, "Exif\0\0", 6 ) != 0 ) return;
+  const uint8_t* tiff = exif + 6;
+  size_t tiffLen = exifLen - 6;
+  bool le = tiff[0] == 'I';
+  auto u16 = [&]( size_t off ) -> uint16_t { return le ? tiff[off] | ( tiff[off+1] << 8 ) : ( tiff[off] << 8 ) | tiff[off+1]; };
+  size_t ifd = le ? le32( tiff+4 ) : ( (uint32_t)tiff[4] << 24 ) | ( tiff[5] << 16 ) | ( tiff[6] << 8 ) | tiff[7];
+  if( ifd + 2 > tiffLen ) return;
+  uint16_t entries = u16( ifd );
+  for( uint16_t i=0; i<entries && ifd + 2 + i*12 + 12 <= tiffLen; i++ ) {
+    size_t entry = ifd + 2 + i*12;
+    if( u16( entry ) != 0x0112 ) continue;
+    uint16_t orientation = u16( entry + 8 );
+    if( orientation < 2 || orientation > 8 ) return; // 1 is the default, nothing to keep
+    const uint8_t app1[] = {
+      0xFF,0xE1, 0,34, 'E','x','i','f',0,0,
+      'M','M',0,42, 0,0,0,8,               // big endian TIFF header, IFD0 at 8
+      0,1,                                 // one entry
+      0x01,0x12, 0,3, 0,0,0,1, 0,(uint8_t)orientation,0,0, // orientation, SHORT, 1 value
+      0,0,0,0                              // no next IFD
+    };
+    emit( app1, sizeof(app1) );
+    return;
+  }
+}
+
+
+bool imgurJpegSize( fs::File &file, uint16_t &width, uint16_t &height ) {
+  size_t start = file.position();
+  bool found = false;
+  uint8_t b[5];
+  if( file.read( b, 2 ) == 2 && b[0] == 0xFF && b[1] == 0xD8 ) {
+    while( file.read( b, 4 ) == 4 && b[0] == 0xFF ) {
+      uint8_t marker = b[1];
+      uint16_t len = ( b[2] << 8 ) | b[3];
+      // SOFn markers, DHT/JPG/DAC share the range
+      if( marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC ) {
+        if( file.read( b, 5 ) == 5 ) {
+          height = ( b[1] << 8 ) | b[2];
+          width  = ( b[3] << 8 ) | b[4];
+          found  = true;
+        }
+        break;
+      }
+      if( len < 2 || !file.seek( len - 2, fs::SeekCur ) ) break;
+    }
+  }
+  file.seek( start );
+  return found;
+}
+
+
+bool imgurJpegSize( const uint8_t* data, size_t len, uint16_t &width, uint16_t &height ) {
+  if( len < 2 || data[0] != 0xFF || data[1] != 0xD8 ) return false;
+  size_t pos = 2;
+  while( pos + 4 <= len && data[pos] == 0xFF ) {
+    uint8_t marker = data[pos+1];
+    uint16_t segLen = ( data[pos+2] << 8 ) | data[pos+3];
+    if( marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC ) {
+      if( pos + 9 > len ) return false;
+      height = ( data[pos+5] << 8 ) | data[pos+6];
+      width  = ( data[pos+7] << 8 ) | data[pos+8];
+      return true;
+    }
+    if( segLen < 2 ) break;
+    pos += 2 + segLen;
+  }
+  return false;
+}
+
+
+bool imgurBmpSize( fs::File &file, uint16_t &width, uint16_t &height ) {
+  size_t start = file.position();
+  uint8_t h[26];
+  bool found = file.read( h, sizeof(h) ) == sizeof(h) && h[0] == 'B' && h[1] == 'M';
+  if( found ) {
+    int32_t w = le32( h+18 ), ht = le32( h+22 );
+    width  = w;
+    height = ht < 0 ? -ht : ht;
+  }
+  file.seek( start );
+  return found;
+}
+
+
+static bool bmpSupported( uint16_t bpp, uint32_t compression ) {
+  return ( compression == 0 || compression == 3 ) && ( bpp == 8 || bpp == 16 || bpp == 24 || bpp == 32 );
+}
+
+
+bool imgurBmpSupported( fs::File &file ) {
+  size_t start = file.position();
+  uint8_t h[34];
+  bool supported = file.read( h, sizeof(h) ) == sizeof(h) && h[0] == 'B' && h[1] == 'M' && bmpSupported( le16( h+28 ), le32( h+30 ) );
+  file.seek( start );
+  return supported;
+}
+
+
+bool imgurDecodeBmp( fs::File &file, ImgurRowSink &sink ) {
+  uint8_t h[54];
+  if( file.read( h, sizeof(h) ) != sizeof(h) || h[0] != 'B' || h[1] != 'M' ) {
+    log_n("Not a BMP file");
+    return false;
+  }
+  uint32_t dataOffset  = le32( h+10 );
+  uint32_t dibSize     = le32( h+14 );
+  int32_t  width       = le32( h+18 );
+  int32_t  height      = le32( h+22 );
+  uint16_t bpp         = le16( h+28 );
+  uint32_t compression = le32( h+30 );
+  uint32_t colors      = le32( h+46 );
+  bool topDown = height < 0; // rows are usually stored bottom-up
+  if( topDown ) height = -height;
+  uint8_t masks[12]; // BI_BITFIELDS red, green, blue
+  bool rgb565 = bpp == 16 && compression == 3 && file.read( masks, sizeof(masks) ) == sizeof(masks) && le32( masks+4 ) == 0x07E0;
+  if( width <= 0 || width > 0xFFFF || height > 0xFFFF || !bmpSupported( bpp, compression ) ) {
+    log_n("Unsupported BMP (%d bits, compression %d)", bpp, compression);
+    return false;
+  }
+  uint32_t stride = ( ( width * bpp + 31 ) / 32 ) * 4; // rows are padded to 4 bytes
+  uint8_t* raw = (uint8_t*)malloc( stride + width * 3 + ( bpp == 8 ? 1024 : 0 ) );
+  if( raw == NULL ) {
+    log_e("Can't alloc BMP row (%d pixels)", width);
+    return false;
+  }
+  uint8_t* rgb = raw + stride;
+  uint8_t* palette = rgb + width * 3; // BGRA entries
+  if( bpp == 8 ) {
+    if( colors == 0 || colors > 256 ) colors = 256;
+    memset( palette, 0, 1024 );
+    if( !file.seek( 14 + dibSize ) || file.read( palette, colors * 4 ) != colors * 4 ) {
+      free( raw );
+      return false;
+    }
+  }
+  bool ok = sink.beginImage( width, height );
+  for( int32_t y=0; ok && y<height; y++ ) {
+    uint32_t fileRow = topDown ? y : height - 1 - y;
+    if( !file.seek( dataOffset + fileRow * stride ) || file.read( raw, stride ) != stride ) {
+      log_n("BMP truncated at row %d", y);
+      ok = false;
+      break;
+    }
+    for( int32_t x=0; x<width; x++ ) {
+      uint8_t* p = rgb + x * 3;
+      switch( bpp ) {
+        case 8:
+          p[0] = palette[raw[x]*4+2];
+          p[1] = palette[raw[x]*4+1];
+          p[2] = palette[raw[x]*4];
+        break;
+        case 16:
+          {
+            uint16_t v = le16( raw + x*2 );
+            if( rgb565 ) {
+              p[0] = ( ( v >> 11 ) & 0x1F ) * 255 / 31;
+              p[1] = ( ( v >> 5 )  & 0x3F ) * 255 / 63;
+            } else { // X1R5G5B5
+              p[0] = ( ( v >> 10 ) & 0x1F ) * 255 / 31;
+              p[1] = ( ( v >> 5 )  & 0x1F ) * 255 / 31;
+            }
+            p[2] = ( v & 0x1F ) * 255 / 31;
+          }
+        break;
+        default: // 24 and 32 bits are BGR(A)
+          {
+            const uint8_t* s = raw + x * ( bpp / 8 );
+            p[0] = s[2];
+            p[1] = s[1];
+            p[2] = s[0];
+          }
+        break;
+      }
+    }
+    ok = sink.writeRow( rgb );
+  }
+  ok = sink.endImage() && ok;
+  free( raw );
+  return ok;
+}
+
+
+#ifdef IMGUR_HAS_TJPGD
+
+struct JpegDecodeContext {
+  fs::File     *file;
+  ImgurRowSink *sink;
+  uint8_t      *strip;  // one row of MCUs
+  uint16_t      width;  // scaled width
+};
+
+
+static UINT jpegInput( JDEC* jd, BYTE* buf, UINT len ) {
+  JpegDecodeContext *ctx = (JpegDecodeContext*)jd->device;
+  if( buf ) return ctx->file->read( buf, len );
+  return ctx->file->seek( len, fs::SeekCur ) ? len : 0;
+}
+
+
+// MCUs come left to right, rows are forwarded when the rightmost one is decoded
+static UINT jpegOutput( JDEC* jd, void* bitmap, JRECT* rect ) {
+  JpegDecodeContext *ctx = (JpegDecodeContext*)jd->device;
+  uint16_t w = rect->right - rect->left + 1;
+  uint16_t h = rect->bottom - rect->top + 1;
+  const uint8_t* src = (const uint8_t*)bitmap;
+  for( uint16_t y=0; y<h; y++ ) {
+    memcpy( ctx->strip + ( y*ctx->width + rect->left )*3, src + y*w*3, w*3 );
+  }
+  if( rect->right + 1 < ctx->width ) return 1;
+  for( uint16_t y=0; y<h; y++ ) {
+    if( !ctx->sink->writeRow( ctx->strip + y*ctx->width*3 ) ) return 0;
+  }
+  return 1;
+}
+
+
+bool imgurDecodeJpeg( fs::File &file, uint16_t maxDimension, ImgurRowSink &sink ) {
+  void* work = malloc( IMGUR_TJPGD_WORKSIZE );
+  if( work == NULL ) {
+    log_e("Can't alloc %d bytes, aborting", IMGUR_TJPGD_WORKSIZE);
+    return false;
+  }
+  JpegDecodeContext ctx = { &file, &sink, NULL, 0 };
+  JDEC jd;
+  JRESULT res = jd_prepare( &jd, jpegInput, work, IMGUR_TJPGD_WORKSIZE, &ctx );
+  if( res != JDR_OK ) {
+    log_n("Not a baseline JPEG (tjpgd error %d)", res);
+    free( work );
+    return false;
+  }
+  uint8_t scale = 0;
+  uint16_t largest = jd.width > jd.height ? jd.width : jd.height;
+  uint16_t smallest = jd.width > jd.height ? jd.height : jd.width;
+  while( scale < 3 && maxDimension > 0 && ( largest >> (scale+1) ) >= maxDimension && ( smallest >> (scale+1) ) > 0 ) {
+    scale++;
+  }
+  // tjpgd rounds the scaled size down, the partial pixel at the right/bottom edge is dropped
+  ctx.width = jd.width >> scale;
+  uint16_t height = jd.height >> scale;
+  uint16_t stripRows = ( jd.msy * 8 ) >> scale;
+  if( stripRows == 0 ) stripRows = 1;
+  ctx.strip = (uint8_t*)malloc( ctx.width * stripRows * 3 );
+  bool ok = false;
+  if( ctx.strip == NULL ) {
+    log_e("Can't alloc %d bytes, aborting", ctx.width * stripRows * 3);
+  } else {
+    ok = sink.beginImage( ctx.width, height );
+    if( ok && ( res = jd_decomp( &jd, jpegOutput, scale ) ) != JDR_OK ) {
+      log_n("JPEG decoding failed (tjpgd error %d)", res);
+      ok = false;
+    }
+    ok = sink.endImage() && ok;
+  }
+  free( ctx.strip );
+  free( work );
+  return ok;
+}
+
+#else
+
+bool imgurDecodeJpeg( fs::File &file, uint16_t maxDimension, ImgurRowSink &sink ) {
+  (void)file;
+  (void)maxDimension;
+  (void)sink;
+  log_n("No JPEG decoder (tjpgd) on this target");
+  return false;
+}
+
+#endif
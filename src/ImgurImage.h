@@ -0,0 +1,143 @@
+/*
+
+  Imgur Image Upload library for ESP32
+
+  Row based image pipeline: decoders push RGB888 rows into chained sinks
+  (resizer, encoders...) so whole frames never have to fit in RAM.
+
+  MIT License
+
+  Copyright (c) 2019 tobozo
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef imgur_image_h
+#define imgur_image_h
+
+#include <Arduino.h>
+#include <FS.h>
+
+
+// receives an image row by row, top to bottom, as RGB888 pixels
+class ImgurRowSink {
+  public:
+    virtual ~ImgurRowSink() { }
+    virtual bool beginImage( uint16_t width, uint16_t height ) = 0;
+    virtual bool writeRow( const uint8_t* rgb888 ) = 0;
+    virtual bool endImage() = 0;
+};
+
+
+// box filter downscaler: fits the image within maxDimension x maxDimension, keeps the aspect ratio
+class ImgurResizer : public ImgurRowSink {
+  public:
+    ImgurResizer( uint16_t maxDimension, ImgurRowSink &next );
+    ~ImgurResizer();
+    bool beginImage( uint16_t width, uint16_t height );
+    bool writeRow( const uint8_t* rgb888 );
+    bool endImage();
+  private:
+    void release();
+    uint16_t      maxDimension;
+    ImgurRowSink &next;
+    uint16_t      inWidth, inHeight, outWidth, outHeight;
+    uint16_t      inRow, outRow;
+    uint32_t*     acc;    // vertical sums for the current output row
+    uint16_t      accRows;
+    uint8_t*      row;    // output row
+};
+
+
+// perceptual signature: average luma of a 16x16 grid of cells, small changes (a clock, noise)
+// only move a few cells while a different screen moves most of them
+class ImgurImageSignature : public ImgurRowSink {
+  public:
+    enum { GRID = 16 };
+    ImgurImageSignature() : valid(false) { ; }
+    bool beginImage( uint16_t width, uint16_t height );
+    bool writeRow( const uint8_t* rgb888 );
+    bool endImage();
+    // how many cells differ by more than cellDelta luma levels, GRID*GRID if not comparable
+    uint16_t distance( const ImgurImageSignature &other, uint8_t cellDelta ) const;
+    bool     valid;
+  private:
+    void     closeCellRow();
+    uint8_t  cells[GRID*GRID];
+    uint32_t sums[GRID];
+    uint16_t width, height, row, cellRow, cellRowStart;
+};
+
+
+// streaming JPEG filter dropping APPn/COM metadata segments (EXIF, thumbnails, XMP, maker notes...)
+// until the first scan, the entropy coded data is copied as is
+class ImgurJpegStripper : public Print {
+  public:
+    enum {
+      KEEP_ICC         = 1, // keep APP2 (ICC color profile)
+      KEEP_ORIENTATION = 2  // replace EXIF by a minimal one holding only the orientation tag
+    };
+    // out can be NULL to only measure the filtered size
+    ImgurJpegStripper( uint8_t keep, Print* out );
+    size_t write( uint8_t c );
+    size_t write( const uint8_t* data, size_t len );
+    using  Print::write;
+    // headers are done, the remaining input is copied unchanged
+    bool   passthrough() { return state == STATE_PASS; }
+    // filtered bytes so far
+    size_t size() { return written; }
+  private:
+    enum { STATE_MARKER, STATE_LENGTH, STATE_SEGMENT, STATE_EXIF, STATE_PASS };
+    bool     emit( const uint8_t* data, size_t len );
+    void     emitOrientation();
+    uint8_t  keep;
+    Print*   out;
+    uint8_t  state;
+    uint8_t  head[4];   // FF, marker, length
+    uint8_t  headLen;
+    uint16_t remaining; // segment bytes left
+    bool     keepSegment;
+    uint8_t  exif[256]; // beginning of the EXIF segment, IFD0 is usually there
+    uint16_t exifLen;
+    size_t   written;
+    bool     failed;
+};
+
+
+// reads the JPEG dimensions from the frame header, the file position is preserved
+bool imgurJpegSize( fs::File &file, uint16_t &width, uint16_t &height );
+
+// same from a JPEG in memory
+bool imgurJpegSize( const uint8_t* data, size_t len, uint16_t &width, uint16_t &height );
+
+// decodes a JPEG file into sink, downscaled by the decoder (1/2, 1/4 or 1/8)
+// as long as the result stays larger than maxDimension (0 = full size)
+bool imgurDecodeJpeg( fs::File &file, uint16_t maxDimension, ImgurRowSink &sink );
+
+// reads the bitmap dimensions from its header, the file position is preserved
+bool imgurBmpSize( fs::File &file, uint16_t &width, uint16_t &height );
+
+// whether imgurDecodeBmp() can read the file (uncompressed 8/16/24/32 bits), the file position is preserved
+bool imgurBmpSupported( fs::File &file );
+
+// decodes an uncompressed 8/16/24/32 bits BMP file into sink, one file row in memory
+bool imgurDecodeBmp( fs::File &file, ImgurRowSink &sink );
+
+#endif
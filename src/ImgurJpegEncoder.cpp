@@ -0,0 +1,369 @@
+/*
+
+  Imgur Image Upload library for ESP32
+
+  Streaming baseline JPEG encoder: RGB888 rows in, 4:2:0 JPEG bytes out,
+  only one 16 rows strip is kept in memory.
+
+  MIT License
+
+  Copyright (c) 2019 tobozo
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include "ImgurJpegEncoder.h"
+#include <math.h>
+
+
+// natural order index -> zigzag position
+static const uint8_t zigzag[64] = {
+   0, 1, 5, 6,14,15,27,28, 2, 4, 7,13,16,26,29,42, 3, 8,12,17,25,30,41,43, 9,11,18,24,31,40,44,53,
+  10,19,23,32,39,45,52,54,20,22,33,38,46,51,55,60,21,34,37,47,50,56,59,61,35,36,48,49,57,58,62,63
+};
+
+// ITU T.81 Annex K tables
+static const uint8_t stdQtY[64] = {
+  16,11,10,16, 24, 40, 51, 61,12,12,14,19, 26, 58, 60, 55,14,13,16,24, 40, 57, 69, 56,14,17,22,29, 51, 87, 80, 62,
+  18,22,37,56, 68,109,103, 77,24,35,55,64, 81,104,113, 92,49,64,78,87,103,121,120,101,72,92,95,98,112,100,103, 99
+};
+static const uint8_t stdQtUV[64] = {
+  17,18,24,47,99,99,99,99,18,21,26,66,99,99,99,99,24,26,56,99,99,99,99,99,47,66,99,99,99,99,99,99,
+  99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99
+};
+static const uint8_t dcYCounts[16]  = { 0,1,5,1,1,1,1,1,1,0,0,0,0,0,0,0 };
+static const uint8_t dcUVCounts[16] = { 0,3,1,1,1,1,1,1,1,1,1,0,0,0,0,0 };
+static const uint8_t dcValues[12]   = { 0,1,2,3,4,5,6,7,8,9,10,11 };
+static const uint8_t acYCounts[16]  = { 0,2,1,3,3,2,4,3,5,5,4,4,0,0,1,0x7d };
+static const uint8_t acYValues[162] = {
+  0x01,0x02,0x03,0x00,0x04,0x11,0x05,0x12,0x21,0x31,0x41,0x06,0x13,0x51,0x61,0x07,0x22,0x71,0x14,0x32,0x81,0x91,0xa1,0x08,
+  0x23,0x42,0xb1,0xc1,0x15,0x52,0xd1,0xf0,0x24,0x33,0x62,0x72,0x82,0x09,0x0a,0x16,0x17,0x18,0x19,0x1a,0x25,0x26,0x27,0x28,
+  0x29,0x2a,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x53,0x54,0x55,0x56,0x57,0x58,0x59,
+  0x5a,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x83,0x84,0x85,0x86,0x87,0x88,0x89,
+  0x8a,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0xa2,0xa3,0xa4,0xa5,0xa6,0xa7,0xa8,0xa9,0xaa,0xb2,0xb3,0xb4,0xb5,0xb6,
+  0xb7,0xb8,0xb9,0xba,0xc2,0xc3,0xc4,0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,0xe1,0xe2,
+  0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa
+};
+static const uint8_t acUVCounts[16] = { 0,2,1,2,4,4,3,4,7,5,4,4,0,1,2,0x77 };
+static const uint8_t acUVValues[162] = {
+  0x00,0x01,0x02,0x03,0x11,0x04,0x05,0x21,0x31,0x06,0x12,0x41,0x51,0x07,0x61,0x71,0x13,0x22,0x32,0x81,0x08,0x14,0x42,0x91,
+  0xa1,0xb1,0xc1,0x09,0x23,0x33,0x52,0xf0,0x15,0x62,0x72,0xd1,0x0a,0x16,0x24,0x34,0xe1,0x25,0xf1,0x17,0x18,0x19,0x1a,0x26,
+  0x27,0x28,0x29,0x2a,0x35,0x36,0x37,0x38,0x39,0x3a,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x53,0x54,0x55,0x56,0x57,0x58,
+  0x59,0x5a,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x82,0x83,0x84,0x85,0x86,0x87,
+  0x88,0x89,0x8a,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0xa2,0xa3,0xa4,0xa5,0xa6,0xa7,0xa8,0xa9,0xaa,0xb2,0xb3,0xb4,
+  0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xc2,0xc3,0xc4,0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,
+  0xe2,0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa
+};
+// AAN DCT output scale factors
+static const float aasf[8] = {
+  1.0f * 2.828427125f, 1.387039845f * 2.828427125f, 1.306562965f * 2.828427125f, 1.175875602f * 2.828427125f,
+  1.0f * 2.828427125f, 0.785694958f * 2.828427125f, 0.541196100f * 2.828427125f, 0.275899379f * 2.828427125f
+};
+
+
+static void buildHuffman( const uint8_t* counts, const uint8_t* values, uint16_t (*table)[2] ) {
+  uint16_t code = 0;
+  uint8_t pos = 0;
+  for( uint8_t len=1; len<=16; len++ ) {
+    for( uint8_t i=0; i<counts[len-1]; i++ ) {
+      table[values[pos]][0] = code++;
+      table[values[pos]][1] = len;
+      pos++;
+    }
+    code <<= 1;
+  }
+}
+
+
+// AAN forward DCT on 8 samples spaced by stride
+static void fdct8( float* d, uint8_t stride ) {
+  float tmp0 = d[0] + d[7*stride], tmp7 = d[0] - d[7*stride];
+  float tmp1 = d[stride] + d[6*stride], tmp6 = d[stride] - d[6*stride];
+  float tmp2 = d[2*stride] + d[5*stride], tmp5 = d[2*stride] - d[5*stride];
+  float tmp3 = d[3*stride] + d[4*stride], tmp4 = d[3*stride] - d[4*stride];
+  // even part
+  float tmp10 = tmp0 + tmp3, tmp13 = tmp0 - tmp3;
+  float tmp11 = tmp1 + tmp2, tmp12 = tmp1 - tmp2;
+  d[0]        = tmp10 + tmp11;
+  d[4*stride] = tmp10 - tmp11;
+  float z1    = ( tmp12 + tmp13 ) * 0.707106781f;
+  d[2*stride] = tmp13 + z1;
+  d[6*stride] = tmp13 - z1;
+  // odd part
+  tmp10 = tmp4 + tmp5;
+  tmp11 = tmp5 + tmp6;
+  tmp12 = tmp6 + tmp7;
+  float z5  = ( tmp10 - tmp12 ) * 0.382683433f;
+  float z2  = tmp10 * 0.541196100f + z5;
+  float z4  = tmp12 * 1.306562965f + z5;
+  float z3  = tmp11 * 0.707106781f;
+  float z11 = tmp7 + z3, z13 = tmp7 - z3;
+  d[5*stride] = z13 + z2;
+  d[3*stride] = z13 - z2;
+  d[stride]   = z11 + z4;
+  d[7*stride] = z11 - z4;
+}
+
+
+ImgurJpegEncoder::ImgurJpegEncoder( uint8_t quality, Print &out ) : quality(quality), out(out), tables(NULL), yStrip(NULL), cbStrip(NULL), crStrip(NULL) {
+  if( this->quality < 1 ) this->quality = 1;
+  if( this->quality > 100 ) this->quality = 100;
+}
+
+
+ImgurJpegEncoder::~ImgurJpegEncoder() {
+  release();
+}
+
+
+void ImgurJpegEncoder::release() {
+  free( tables );
+  free( yStrip );
+  free( cbStrip );
+  free( crStrip );
+  tables  = NULL;
+  yStrip  = NULL;
+  cbStrip = NULL;
+  crStrip = NULL;
+}
+
+
+bool ImgurJpegEncoder::beginImage( uint16_t width, uint16_t height ) {
+  this->width  = width;
+  this->height = height;
+  paddedWidth  = ( width + 15 ) & ~15;
+  row    = 0;
+  dcY    = dcCb = dcCr = 0;
+  bitBuf = 0;
+  bitCnt = 0;
+  outLen = 0;
+  written = 0;
+  failed = false;
+  release();
+  tables  = (Tables*)malloc( sizeof(Tables) );
+  yStrip  = (uint8_t*)malloc( paddedWidth * 16 );
+  cbStrip = (uint16_t*)calloc( paddedWidth * 4, sizeof(uint16_t) );
+  crStrip = (uint16_t*)calloc( paddedWidth * 4, sizeof(uint16_t) );
+  if( tables == NULL || yStrip == NULL || cbStrip == NULL || crStrip == NULL ) {
+    log_e("Can't alloc JPEG encoder buffers (%d pixels wide)", width);
+    release();
+    return false;
+  }
+  buildHuffman( dcYCounts,  dcValues,   tables->ydc );
+  buildHuffman( acYCounts,  acYValues,  tables->yac );
+  buildHuffman( dcUVCounts, dcValues,   tables->uvdc );
+  buildHuffman( acUVCounts, acUVValues, tables->uvac );
+  // IJG quality scaling
+  int scale = quality < 50 ? 5000 / quality : 200 - quality * 2;
+  for( uint8_t i=0; i<64; i++ ) {
+    int y  = ( stdQtY[i]  * scale + 50 ) / 100;
+    int uv = ( stdQtUV[i] * scale + 50 ) / 100;
+    tables->qtY[zigzag[i]]  = y  < 1 ? 1 : y  > 255 ? 255 : y;
+    tables->qtUV[zigzag[i]] = uv < 1 ? 1 : uv > 255 ? 255 : uv;
+  }
+  for( uint8_t r=0, k=0; r<8; r++ ) {
+    for( uint8_t c=0; c<8; c++, k++ ) {
+      tables->fdtblY[k]  = 1.0f / ( tables->qtY[zigzag[k]]  * aasf[r] * aasf[c] );
+      tables->fdtblUV[k] = 1.0f / ( tables->qtUV[zigzag[k]] * aasf[r] * aasf[c] );
+    }
+  }
+  return writeHeaders();
+}
+
+
+bool ImgurJpegEncoder::writeHeaders() {
+  static const uint8_t soi[] = { 0xFF,0xD8, 0xFF,0xE0,0,16,'J','F','I','F',0,1,1,0,0,1,0,1,0,0 };
+  for( uint8_t i=0; i<sizeof(soi); i++ ) putByte( soi[i] );
+  // quantization tables
+  putByte( 0xFF ); putByte( 0xDB ); putByte( 0 ); putByte( 132 );
+  putByte( 0 );
+  for( uint8_t i=0; i<64; i++ ) putByte( tables->qtY[i] );
+  putByte( 1 );
+  for( uint8_t i=0; i<64; i++ ) putByte( tables->qtUV[i] );
+  // baseline frame, Y sampled 2x2, Cb/Cr 1x1
+  const uint8_t sof[] = { 0xFF,0xC0,0,17,8, (uint8_t)(height>>8),(uint8_t)height, (uint8_t)(width>>8),(uint8_t)width,
+                          3, 1,0x22,0, 2,0x11,1, 3,0x11,1 };
+  for( uint8_t i=0; i<sizeof(sof); i++ ) putByte( sof[i] );
+  // huffman tables
+  putByte( 0xFF ); putByte( 0xC4 ); putByte( 0x01 ); putByte( 0xA2 );
+  const uint8_t* counts[4] = { dcYCounts, acYCounts, dcUVCounts, acUVCounts };
+  const uint8_t* values[4] = { dcValues,  acYValues, dcValues,   acUVValues };
+  const uint8_t  classes[4] = { 0x00, 0x10, 0x01, 0x11 };
+  for( uint8_t t=0; t<4; t++ ) {
+    putByte( classes[t] );
+    uint16_t total = 0;
+    for( uint8_t i=0; i<16; i++ ) {
+      putByte( counts[t][i] );
+      total += counts[t][i];
+    }
+    for( uint16_t i=0; i<total; i++ ) putByte( values[t][i] );
+  }
+  // start of scan
+  static const uint8_t sos[] = { 0xFF,0xDA,0,12,3, 1,0x00, 2,0x11, 3,0x11, 0,0x3F,0 };
+  for( uint8_t i=0; i<sizeof(sos); i++ ) putByte( sos[i] );
+  return flush();
+}
+
+
+bool ImgurJpegEncoder::writeRow( const uint8_t* rgb888 ) {
+  if( failed || yStrip == NULL || row >= height ) return false;
+  uint8_t  y  = row & 15;
+  uint8_t* ys = yStrip + y * paddedWidth;
+  uint16_t* cbs = cbStrip + ( y >> 1 ) * ( paddedWidth >> 1 );
+  uint16_t* crs = crStrip + ( y >> 1 ) * ( paddedWidth >> 1 );
+  for( uint16_t x=0; x<paddedWidth; x++ ) {
+    const uint8_t* p = rgb888 + ( x < width ? x : width-1 ) * 3; // right padding repeats the last pixel
+    int r = p[0], g = p[1], b = p[2];
+    ys[x]      = (  77*r + 150*g +  29*b + 128 ) >> 8;
+    cbs[x>>1] += ( -43*r -  85*g + 128*b + 32768 + 128 ) >> 8;
+    crs[x>>1] += ( 128*r - 107*g -  21*b + 32768 + 128 ) >> 8;
+  }
+  row++;
+  if( row == height ) {
+    // bottom padding repeats the last row
+    for( uint8_t pad=y+1; pad<16; pad++ ) {
+      memcpy( yStrip + pad * paddedWidth, ys, paddedWidth );
+    }
+    uint16_t halfWidth = paddedWidth >> 1;
+    if( ( y & 1 ) == 0 ) {
+      // the last chroma row only got one pixel row out of two
+      for( uint16_t x=0; x<halfWidth; x++ ) {
+        cbs[x] *= 2;
+        crs[x] *= 2;
+      }
+    }
+    for( uint8_t pad=(y>>1)+1; pad<8; pad++ ) {
+      memcpy( cbStrip + pad * halfWidth, cbs, halfWidth * sizeof(uint16_t) );
+      memcpy( crStrip + pad * halfWidth, crs, halfWidth * sizeof(uint16_t) );
+    }
+    encodeStrip();
+  } else if( y == 15 ) {
+    encodeStrip();
+  }
+  return !failed;
+}
+
+
+void ImgurJpegEncoder::encodeStrip() {
+  float du[64];
+  uint16_t halfWidth = paddedWidth >> 1;
+  for( uint16_t mx=0; mx<paddedWidth; mx+=16 ) {
+    for( uint8_t by=0; by<16; by+=8 ) {
+      for( uint8_t bx=0; bx<16; bx+=8 ) {
+        for( uint8_t i=0; i<64; i++ ) {
+          du[i] = yStrip[ ( by + (i>>3) ) * paddedWidth + mx + bx + (i&7) ] - 128.0f;
+        }
+        dcY = encodeBlock( du, tables->fdtblY, dcY, tables->ydc, tables->yac );
+      }
+    }
+    for( uint8_t i=0; i<64; i++ ) {
+      du[i] = cbStrip[ (i>>3) * halfWidth + (mx>>1) + (i&7) ] * 0.25f - 128.0f;
+    }
+    dcCb = encodeBlock( du, tables->fdtblUV, dcCb, tables->uvdc, tables->uvac );
+    for( uint8_t i=0; i<64; i++ ) {
+      du[i] = crStrip[ (i>>3) * halfWidth + (mx>>1) + (i&7) ] * 0.25f - 128.0f;
+    }
+    dcCr = encodeBlock( du, tables->fdtblUV, dcCr, tables->uvdc, tables->uvac );
+  }
+  memset( cbStrip, 0, paddedWidth * 4 * sizeof(uint16_t) );
+  memset( crStrip, 0, paddedWidth * 4 * sizeof(uint16_t) );
+  flush();
+}
+
+
+// DCT, quantization, zigzag and huffman coding of one 8x8 block, returns the new DC predictor
+int ImgurJpegEncoder::encodeBlock( float* du, const float* fdtbl, int dc, const uint16_t (*htdc)[2], const uint16_t (*htac)[2] ) {
+  for( uint8_t i=0; i<64; i+=8 ) fdct8( du + i, 1 );
+  for( uint8_t i=0; i<8; i++ )   fdct8( du + i, 8 );
+  int q[64];
+  for( uint8_t i=0; i<64; i++ ) {
+    float v = du[i] * fdtbl[i];
+    q[zigzag[i]] = (int)( v < 0 ? ceilf( v - 0.5f ) : floorf( v + 0.5f ) );
+  }
+  // value as (magnitude category, bits)
+  auto category = []( int v, uint16_t &bits ) -> uint8_t {
+    int a = v < 0 ? -v : v;
+    uint8_t n = 0;
+    while( a ) { n++; a >>= 1; }
+    bits = ( v < 0 ? v - 1 : v ) & ( ( 1 << n ) - 1 );
+    return n;
+  };
+  uint16_t bits;
+  int diff = q[0] - dc;
+  uint8_t n = category( diff, bits );
+  writeBits( htdc[n][0], htdc[n][1] );
+  if( n ) writeBits( bits, n );
+  uint8_t last = 63;
+  while( last > 0 && q[last] == 0 ) last--;
+  for( uint8_t i=1; i<=last; i++ ) {
+    uint8_t zeros = 0;
+    while( q[i] == 0 ) { zeros++; i++; }
+    while( zeros >= 16 ) {
+      writeBits( htac[0xF0][0], htac[0xF0][1] ); // 16 zeros
+      zeros -= 16;
+    }
+    n = category( q[i], bits );
+    writeBits( htac[(zeros<<4) + n][0], htac[(zeros<<4) + n][1] );
+    writeBits( bits, n );
+  }
+  if( last != 63 ) writeBits( htac[0][0], htac[0][1] ); // end of block
+  return q[0];
+}
+
+
+void ImgurJpegEncoder::writeBits( uint16_t code, uint8_t len ) {
+  bitCnt += len;
+  bitBuf |= (uint32_t)code << ( 24 - bitCnt );
+  while( bitCnt >= 8 ) {
+    uint8_t c = ( bitBuf >> 16 ) & 0xFF;
+    putByte( c );
+    if( c == 0xFF ) putByte( 0 ); // byte stuffing
+    bitBuf <<= 8;
+    bitCnt -= 8;
+  }
+}
+
+
+void ImgurJpegEncoder::putByte( uint8_t c ) {
+  outBuf[outLen++] = c;
+  if( outLen == sizeof(outBuf) ) flush();
+}
+
+
+bool ImgurJpegEncoder::flush() {
+  if( outLen > 0 && !failed ) {
+    failed = out.write( outBuf, outLen ) != outLen;
+    written += outLen;
+  }
+  outLen = 0;
+  return !failed;
+}
+
+
+bool ImgurJpegEncoder::endImage() {
+  if( tables == NULL ) return false;
+  bool complete = row == height;
+  writeBits( 0x7F, 7 ); // pad the last byte with 1s
+  putByte( 0xFF );
+  putByte( 0xD9 );
+  bool ok = flush() && complete;
+  release();
+  return ok;
+}
@@ -0,0 +1,80 @@
+/*
+
+  Imgur Image Upload library for ESP32
+
+  Streaming baseline JPEG encoder: RGB888 rows in, 4:2:0 JPEG bytes out,
+  only one 16 rows strip is kept in memory.
+
+  MIT License
+
+  Copyright (c) 2019 tobozo
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef imgur_jpeg_encoder_h
+#define imgur_jpeg_encoder_h
+
+#include "ImgurImage.h"
+
+
+class ImgurJpegEncoder : public ImgurRowSink {
+  public:
+    // quality is 1..100, encoded bytes are written to out
+    ImgurJpegEncoder( uint8_t quality, Print &out );
+    ~ImgurJpegEncoder();
+    bool beginImage( uint16_t width, uint16_t height );
+    bool writeRow( const uint8_t* rgb888 );
+    bool endImage();
+    // encoded bytes so far
+    size_t size() { return written; }
+    // pixels of the image being encoded
+    uint32_t pixels() { return (uint32_t)width * height; }
+  private:
+    struct Tables {
+      uint16_t ydc[256][2], yac[256][2], uvdc[256][2], uvac[256][2]; // code, bit length
+      float    fdtblY[64], fdtblUV[64];
+      uint8_t  qtY[64], qtUV[64];                                    // zigzag order, as in DQT
+    };
+    void     release();
+    bool     writeHeaders();
+    void     encodeStrip();
+    int      encodeBlock( float* du, const float* fdtbl, int dc, const uint16_t (*htdc)[2], const uint16_t (*htac)[2] );
+    void     writeBits( uint16_t code, uint8_t len );
+    void     putByte( uint8_t c );
+    bool     flush();
+    uint8_t  quality;
+    Print   &out;
+    Tables  *tables;
+    uint16_t width, height, paddedWidth;
+    uint16_t row;        // rows received
+    uint8_t *yStrip;     // 16 rows of luma
+    uint16_t*cbStrip;    // 8 rows of 2x2 chroma sums
+    uint16_t*crStrip;
+    int      dcY, dcCb, dcCr;
+    uint32_t bitBuf;
+    uint8_t  bitCnt;
+    uint8_t  outBuf[256];
+    uint16_t outLen;
+    size_t   written;
+    bool     failed;
+};
+
+#endif
@@ -0,0 +1,93 @@
+/*
+
+  Imgur Image Upload library for ESP32
+
+  Single producer / single consumer lock-free ring buffer, lets an ISR or
+  a capture task feed ImgurUploader::uploadRing() while the upload runs.
+
+  MIT License
+
+  Copyright (c) 2019 tobozo
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef imgur_ring_buffer_h
+#define imgur_ring_buffer_h
+
+#include <Arduino.h>
+#include <atomic>
+
+
+class ImgurRingBuffer {
+  public:
+
+    // storage is owned by the caller, size must be a power of two
+    ImgurRingBuffer( uint8_t* storage, size_t size ) : _buf(storage), _mask(size-1), _head(0), _tail(0), _closed(false) { ; }
+
+    // producer side (ISR or capture task): returns how many bytes fit, the rest must be pushed again
+    IRAM_ATTR size_t push( const uint8_t* data, size_t len ) {
+      size_t head = _head.load( std::memory_order_relaxed );
+      size_t tail = _tail.load( std::memory_order_acquire );
+      size_t room = (_mask + 1) - (head - tail);
+      if( len > room ) len = room;
+      for( size_t i=0; i<len; i++ ) {
+        _buf[(head + i) & _mask] = data[i];
+      }
+      _head.store( head + len, std::memory_order_release );
+      return len;
+    }
+
+    // producer side: no more data will be pushed for this image
+    IRAM_ATTR void close() { _closed.store( true, std::memory_order_release ); }
+
+    // consumer side (uploader): returns how many bytes were copied into data
+    size_t pop( uint8_t* data, size_t maxLen ) {
+      size_t tail = _tail.load( std::memory_order_relaxed );
+      size_t head = _head.load( std::memory_order_acquire );
+      size_t len = head - tail;
+      if( len > maxLen ) len = maxLen;
+      size_t first = (_mask + 1) - (tail & _mask); // bytes before wrapping
+      if( first > len ) first = len;
+      memcpy( data, _buf + (tail & _mask), first );
+      memcpy( data + first, _buf, len - first );
+      _tail.store( tail + len, std::memory_order_release );
+      return len;
+    }
+
+    size_t available() const { return _head.load( std::memory_order_acquire ) - _tail.load( std::memory_order_relaxed ); }
+
+    // closed and fully drained
+    bool   finished() const { return _closed.load( std::memory_order_acquire ) && available() == 0; }
+
+    // rearm for the next image, only when neither side is running
+    void   reset() { _head = 0; _tail = 0; _closed = false; }
+
+  private:
+
+    uint8_t*            _buf;
+    size_t              _mask;
+    std::atomic<size_t> _head; // only written by the producer
+    std::atomic<size_t> _tail; // only written by the consumer
+    std::atomic<bool>   _closed;
+
+};
+
+#endif
@@ -0,0 +1,337 @@
+/*
+
+  Imgur Image Upload library for ESP32
+
+  Upload queue: jobs are ordered by priority class, earliest deadline first
+  within a class, and urgent jobs preempt a running bulk upload between two
+  packets or while it waits, using a second connection.
+
+  MIT License
+
+  Copyright (c) 2019 tobozo
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include "ImgurUploadQueue.h"
+
+#define IMGUR_QUEUE_IDLE 0xFF
+
+
+ImgurUploadQueue::ImgurUploadQueue( ImgurUploader &main, ImgurUploader &urgent ) : _main(main), _urgent(urgent) {
+  memset( _jobs, 0, sizeof(_jobs) );
+  _nextId     = 1;
+  _seq        = 0;
+  _running    = IMGUR_QUEUE_IDLE;
+  _preempting = false;
+  _runningKey = 0;
+  _runningId  = 0;
+  _urgentId   = 0;
+  _runningUpload = 0;
+  _urgentUpload  = 0;
+  _abortStale = false;
+  _abortRunning = false;
+  _doneCB     = NULL;
+  _radioCB    = NULL;
+  _clockCB    = NULL;
+  _batchCount = 0;
+  _batchBytes = 0;
+  _batchAge   = 0;
+  _draining   = false;
+  _radioSince = 0;
+  _wakeups    = 0;
+  _jobsSent   = 0;
+  _lock       = portMUX_INITIALIZER_UNLOCKED;
+  _main.setChunkCallback( &chunkCallback, this );
+}
+
+
+uint16_t ImgurUploadQueue::addFile( fs::FS &fs, const char* path, Priority priority, uint32_t deadlineMs, uint16_t coalesceKey ) {
+  Job job;
+  memset( &job, 0, sizeof(job) );
+  if( strlen( path ) >= sizeof(job.path) ) {
+    log_n("Path too long for the queue: %s", path);
+    return 0;
+  }
+  File file = fs.open( path );
+  if( !file ) {
+    log_n("Could not open path %s", path );
+    return 0;
+  }
+  job.len = file.size(); // counts toward the batch size
+  file.close();
+  strlcpy( job.path, path, sizeof(job.path) );
+  job.fs = &fs;
+  job.priority = priority;
+  job.hasDeadline = deadlineMs > 0;
+  job.added = now();
+  job.due = job.added + deadlineMs;
+  job.key = coalesceKey;
+  return add( job );
+}
+
+
+uint16_t ImgurUploadQueue::addBytes( const uint8_t* data, size_t len, const char* imageName, Priority priority, uint32_t deadlineMs, uint16_t coalesceKey ) {
+  Job job;
+  memset( &job, 0, sizeof(job) );
+  strlcpy( job.path, imageName, sizeof(job.path) );
+  job.data = data;
+  job.len = len;
+  job.priority = priority;
+  job.hasDeadline = deadlineMs > 0;
+  job.added = now();
+  job.due = job.added + deadlineMs;
+  job.key = coalesceKey;
+  return add( job );
+}
+
+
+// may be called from any task
+uint16_t ImgurUploadQueue::add( const Job &job ) {
+  uint16_t id = 0;
+  uint16_t replaced = 0;
+  int slot = -1;
+  portENTER_CRITICAL( &_lock );
+  for( uint8_t i=0; i<IMGUR_QUEUE_SIZE; i++ ) {
+    if( job.key != 0 && _jobs[i].id != 0 && _jobs[i].key == job.key ) {
+      // latest frame wins, the stale one never starts
+      replaced = _jobs[i].id;
+      slot = i;
+      break;
+    }
+    if( slot < 0 && _jobs[i].id == 0 ) slot = i;
+  }
+  if( slot >= 0 ) {
+    id = _nextId++;
+    if( _nextId == 0 ) _nextId = 1;
+    if( replaced != 0 ) {
+      // only the payload is new: the job keeps its age for batching and its FIFO place
+      uint32_t added = _jobs[slot].added;
+      uint32_t seq = _jobs[slot].seq;
+      _jobs[slot] = job;
+      _jobs[slot].added = added;
+      _jobs[slot].seq = seq;
+    } else {
+      _jobs[slot] = job;
+      _jobs[slot].seq = _seq++;
+    }
+    _jobs[slot].id = id;
+    if( _abortStale && job.key != 0 && _runningKey == job.key ) _abortRunning = true;
+  }
+  portEXIT_CRITICAL( &_lock );
+  if( id == 0 ) log_n("Upload queue full");
+  if( replaced != 0 ) {
+    log_d("Job #%d replaces job #%d", id, replaced);
+    if( _doneCB ) _doneCB( replaced, -ImgurUploader::PHASE_REPLACED, _main );
+  }
+  return id;
+}
+
+
+size_t ImgurUploadQueue::pending() {
+  size_t count = 0;
+  portENTER_CRITICAL( &_lock );
+  for( uint8_t i=0; i<IMGUR_QUEUE_SIZE; i++ ) {
+    if( _jobs[i].id != 0 ) count++;
+  }
+  portEXIT_CRITICAL( &_lock );
+  return count;
+}
+
+
+// removes the best job with a priority class below (more urgent than) the given one:
+// lowest class first, then earliest deadline, jobs without deadline last, then FIFO,
+// it is marked as running at once so a cancel can't miss it before it starts
+bool ImgurUploadQueue::takeNext( Job &job, uint8_t below, bool urgent ) {
+  int best = -1;
+  portENTER_CRITICAL( &_lock );
+  for( uint8_t i=0; i<IMGUR_QUEUE_SIZE; i++ ) {
+    const Job &j = _jobs[i];
+    if( j.id == 0 || j.priority >= below ) continue;
+    if( best < 0 ) {
+      best = i;
+      continue;
+    }
+    const Job &b = _jobs[best];
+    bool better;
+    if( j.priority != b.priority )            better = j.priority < b.priority;
+    else if( j.hasDeadline != b.hasDeadline ) better = j.hasDeadline;
+    else if( j.hasDeadline && j.due != b.due ) better = (int32_t)( j.due - b.due ) < 0;
+    else                                      better = (int32_t)( j.seq - b.seq ) < 0;
+    if( better ) best = i;
+  }
+  if( best >= 0 ) {
+    job = _jobs[best];
+    _jobs[best].id = 0;
+    if( urgent ) {
+      _urgentId = job.id;
+      _urgentUpload = _urgent.reserveUploadId();
+    } else {
+      _running = job.priority;
+      _runningKey = job.key;
+      _runningId = job.id;
+      _runningUpload = _main.reserveUploadId();
+      _abortRunning = false;
+    }
+  }
+  portEXIT_CRITICAL( &_lock );
+  return best >= 0;
+}
+
+
+int ImgurUploadQueue::run( const Job &job, ImgurUploader &uploader ) {
+  uint32_t t = now();
+  if( job.hasDeadline && (int32_t)( t - job.due ) > 0 ) {
+    log_n("Job #%d is %d ms late", job.id, t - job.due);
+  }
+  return job.fs != NULL ? uploader.uploadFile( *job.fs, job.path ) : uploader.uploadBytes( job.data, job.len, job.path );
+}
+
+
+// may be called from any task
+bool ImgurUploadQueue::cancel( uint16_t jobId ) {
+  if( jobId == 0 ) return false;
+  bool dropped = false, found = false;
+  portENTER_CRITICAL( &_lock );
+  for( uint8_t i=0; i<IMGUR_QUEUE_SIZE; i++ ) {
+    if( _jobs[i].id == jobId ) {
+      _jobs[i].id = 0;
+      dropped = true;
+      break;
+    }
+  }
+  if( !dropped ) {
+    if( _runningId == jobId ) {
+      _main.cancel( _runningUpload );
+      found = true;
+    } else if( _urgentId == jobId ) {
+      _urgent.cancel( _urgentUpload );
+      found = true;
+    }
+  }
+  portEXIT_CRITICAL( &_lock );
+  if( dropped ) {
+    log_d("Job #%d cancelled before it started", jobId);
+    if( _doneCB ) _doneCB( jobId, -ImgurUploader::PHASE_CANCELLED, _main );
+  }
+  return dropped || found;
+}
+
+
+void ImgurUploadQueue::setBatching( uint8_t count, size_t bytes, uint32_t maxAgeMs ) {
+  _batchCount = count;
+  _batchBytes = bytes;
+  _batchAge   = maxAgeMs;
+}
+
+
+// whether the pending jobs are worth waking the radio for
+bool ImgurUploadQueue::batchReady() {
+  if( _batchCount == 0 && _batchBytes == 0 && _batchAge == 0 ) return true;
+  uint32_t t = now();
+  uint8_t count = 0;
+  size_t bytes = 0;
+  bool ready = false;
+  portENTER_CRITICAL( &_lock );
+  for( uint8_t i=0; i<IMGUR_QUEUE_SIZE && !ready; i++ ) {
+    const Job &j = _jobs[i];
+    if( j.id == 0 ) continue;
+    count++;
+    bytes += j.len;
+    ready = j.priority == PRIORITY_ALERT
+         || ( j.hasDeadline && (int32_t)( t - j.due ) >= 0 )
+         || ( _batchAge > 0 && t - j.added >= _batchAge );
+  }
+  portEXIT_CRITICAL( &_lock );
+  return ready
+      || ( _batchCount > 0 && count >= _batchCount )
+      || ( _batchBytes > 0 && bytes >= _batchBytes )
+      || count == IMGUR_QUEUE_SIZE; // full, holding on would refuse new jobs
+}
+
+
+bool ImgurUploadQueue::process() {
+  bool batching = _batchCount > 0 || _batchBytes > 0 || _batchAge > 0;
+  if( !_draining && !batchReady() ) return false;
+  if( !_draining && batching && pending() > 0 ) {
+    _draining = true;
+    _wakeups++;
+    _radioSince = now();
+    if( _radioCB ) _radioCB( true );
+  }
+  if( _draining && WiFi.status() != WL_CONNECTED && now() - _radioSince < IMGUR_QUEUE_RADIO_WAIT ) {
+    // the radio was just woken up (WiFi.begin() returns before the connection is up),
+    // the jobs would fail with PHASE_WIFI meanwhile
+    return false;
+  }
+  Job job;
+  if( !takeNext( job, IMGUR_QUEUE_IDLE, false ) ) {
+    if( _draining ) {
+      // batch over: close the connections so nothing keeps the radio awake
+      _draining = false;
+      _main.end();
+      _urgent.end();
+      if( _radioCB ) _radioCB( false );
+    }
+    return false;
+  }
+  _jobsSent++;
+  int ret = run( job, _main );
+  // no longer running before anyone hears of it, a cancel from the done callback is then a no-op
+  portENTER_CRITICAL( &_lock );
+  _running = IMGUR_QUEUE_IDLE;
+  _runningKey = 0;
+  _runningId = 0;
+  _runningUpload = 0;
+  portEXIT_CRITICAL( &_lock );
+  if( _doneCB ) _doneCB( job.id, ret, _main );
+  return true;
+}
+
+
+// between two packets of the main upload or while it waits, false stops it
+bool ImgurUploadQueue::chunkCallback( void* queue ) {
+  ImgurUploadQueue* self = (ImgurUploadQueue*)queue;
+  if( self->_abortRunning ) {
+    log_n("A newer job replaces the running upload");
+    return false;
+  }
+  self->preempt();
+  return !self->_abortRunning;
+}
+
+
+// between two packets of the main upload or while it waits: more urgent jobs go first, on the second connection,
+// the main upload then resumes where it was
+void ImgurUploadQueue::preempt() {
+  if( _preempting || _running == IMGUR_QUEUE_IDLE || _running == PRIORITY_ALERT ) return;
+  _preempting = true;
+  Job job;
+  while( takeNext( job, _running, true ) ) {
+    log_d("Job #%d preempts the running upload", job.id);
+    int ret = run( job, _urgent );
+    portENTER_CRITICAL( &_lock );
+    _urgentId = 0;
+    _urgentUpload = 0;
+    portEXIT_CRITICAL( &_lock );
+    if( _doneCB ) _doneCB( job.id, ret, _urgent );
+  }
+  _preempting = false;
+}
@@ -0,0 +1,148 @@
+/*
+
+  Imgur Image Upload library for ESP32
+
+  Upload queue: jobs are ordered by priority class, earliest deadline first
+  within a class, and urgent jobs preempt a running bulk upload between two
+  packets or while it waits, using a second connection.
+
+  MIT License
+
+  Copyright (c) 2019 tobozo
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef imgur_upload_queue_h
+#define imgur_upload_queue_h
+
+#include "ImgurUploader.h"
+
+#define IMGUR_QUEUE_SIZE    8  // pending jobs
+#define IMGUR_QUEUE_PATHLEN 64 // file paths are copied into the job
+#define IMGUR_QUEUE_RADIO_WAIT 20000 // ms a batch waits for WiFi to connect after the radio was woken up
+
+
+class ImgurUploadQueue {
+  public:
+
+    enum Priority {
+      PRIORITY_ALERT = 0, // preempts running uploads of the other classes
+      PRIORITY_NORMAL,
+      PRIORITY_BULK
+    };
+
+    // called when a job is over, uploader holds the URL, status and result of the upload,
+    // ret is -PHASE_REPLACED for a job replaced by a newer one before it started (uploader is then unrelated)
+    typedef void (*DoneCallback)( uint16_t jobId, int ret, ImgurUploader &uploader );
+
+    // jobs run on main, preempting jobs run on urgent while the preempted upload waits on its own connection,
+    // they start at the next packet or wait of the running upload, or after its TLS handshake
+    ImgurUploadQueue( ImgurUploader &main, ImgurUploader &urgent );
+
+    // add an upload, deadlineMs (0 = none) orders jobs of the same class, returns the job id or 0 when the queue is full,
+    // a job with a coalescing key (0 = none) replaces the pending job with the same key: only the latest frame gets uploaded
+    uint16_t addFile( fs::FS &fs, const char* path, Priority priority=PRIORITY_NORMAL, uint32_t deadlineMs=0, uint16_t coalesceKey=0 );
+    // data must stay valid until the job is done
+    uint16_t addBytes( const uint8_t* data, size_t len, const char* imageName="pic.jpg", Priority priority=PRIORITY_NORMAL, uint32_t deadlineMs=0, uint16_t coalesceKey=0 );
+
+    // also cancel the running upload when a job with the same coalescing key is added
+    void     setAbortStale( bool abort ) { _abortStale = abort; }
+
+    // the job id is its cancellation token: a pending job is dropped (done with -PHASE_CANCELLED),
+    // a running one stops at its next packet or while it waits, returns false if the job is already over
+    bool     cancel( uint16_t jobId );
+
+    void     onDone( DoneCallback doneCB ) { _doneCB = doneCB; }
+
+    // radio duty cycle: hold normal/bulk jobs until count jobs, bytes or the age of the oldest one (ms) is reached
+    // (0 = ignored, all 0 to disable), then send them all back-to-back; alerts and due deadlines start a batch at once
+    void     setBatching( uint8_t count, size_t bytes=0, uint32_t maxAgeMs=0 );
+
+    // told when a batch starts (radioNeeded = true, e.g. to bring WiFi up) and when it is over and
+    // the connections are closed (radioNeeded = false, the radio can sleep), the callback doesn't have to
+    // block: the batch is held until WiFi is connected, for up to IMGUR_QUEUE_RADIO_WAIT
+    void     onRadio( void (*radioCB)( bool radioNeeded ) ) { _radioCB = radioCB; }
+
+    // time source for deadlines and batch ages, millis() by default, a simulated clock for host measurements
+    void     setClock( uint32_t (*clockCB)() ) { _clockCB = clockCB; }
+
+    // batches started (radio wake-ups) and uploaded jobs, wakeups/jobs measures how well batching works
+    uint32_t getWakeups() { return _wakeups; }
+    uint32_t getJobsSent() { return _jobsSent; }
+
+    // runs the most urgent job, call from loop() or a dedicated task,
+    // returns false when nothing was pending (or held for the batch)
+    bool     process();
+
+    size_t   pending();
+
+  private:
+
+    struct Job {
+      uint16_t       id;       // 0 for a free slot
+      uint8_t        priority;
+      bool           hasDeadline;
+      uint32_t       due;      // clock time
+      uint32_t       added;
+      uint32_t       seq;      // FIFO order among equals
+      uint16_t       key;      // coalescing key, 0 for none
+      fs::FS*        fs;       // NULL for byte arrays
+      char           path[IMGUR_QUEUE_PATHLEN];
+      const uint8_t* data;
+      size_t         len;      // file size for files
+    };
+
+    static bool chunkCallback( void* queue );
+    uint16_t add( const Job &job );
+    bool     takeNext( Job &job, uint8_t below, bool urgent );
+    int      run( const Job &job, ImgurUploader &uploader );
+    void     preempt();
+    bool     batchReady();
+    uint32_t now() { return _clockCB ? _clockCB() : millis(); }
+
+    ImgurUploader &_main;
+    ImgurUploader &_urgent;
+    Job           _jobs[IMGUR_QUEUE_SIZE];
+    uint16_t      _nextId;
+    uint32_t      _seq;
+    uint8_t       _running;   // priority of the job running on _main, 0xFF when idle
+    bool          _preempting;
+    uint16_t      _runningKey;
+    uint16_t      _runningId;   // job on _main, 0 when idle
+    uint16_t      _urgentId;    // job on _urgent, 0 when idle
+    uint32_t      _runningUpload; // upload ids of these jobs on their uploader
+    uint32_t      _urgentUpload;
+    bool          _abortStale;
+    volatile bool _abortRunning; // set by add(), the running upload stops at the next packet
+    DoneCallback  _doneCB;
+    void          (*_radioCB)( bool radioNeeded );
+    uint32_t      (*_clockCB)();
+    uint8_t       _batchCount;
+    size_t        _batchBytes;
+    uint32_t      _batchAge;
+    bool          _draining;  // a batch is being sent
+    uint32_t      _radioSince; // when the radio was woken up for the batch
+    uint32_t      _wakeups;
+    uint32_t      _jobsSent;
+    portMUX_TYPE  _lock;
+};
+
+#endif
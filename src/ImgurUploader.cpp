@@ -32,24 +32,347 @@
 */
 
 #include "ImgurUploader.h"
+#include "ImgurJpegEncoder.h"
 #include "cert.h"
+#include <esp_idf_version.h>
+#include <esp_timer.h>
+#include <time.h>
 
 #define IMGUR_UPLOAD_API_URL    "/3/image"
 #define IMGUR_UPLOAD_API_DOMAIN "api.imgur.com"
 #define IMGUR_URL_MASK          "https://imgur.com/%s"
+#define IMGUR_ALBUM_API_URL     "/3/album"
+#define IMGUR_ALBUM_URL_MASK    "https://imgur.com/a/%s"
 #define IMGUR_BUFFSIZE          4096
+#define IMGUR_MAP_SLICE         0x10000 // flash is mapped one 64KB MMU page at a time
+#define IMGUR_ADAPTIVE_QUALITY  90    // starting quality when only a delivery budget is set
+#define IMGUR_ADAPTIVE_MIN_DIM  160   // smallest resolution the delivery budget can lead to
+#define IMGUR_MEASURE_MIN_BYTES 16384 // smaller bodies mostly measure socket buffering
+#define IMGUR_SIGNATURE_DIM     64    // images are decoded down to about this size to compute their signature
+#define IMGUR_CHUNK_FRAMING     10    // "%x\r\n" + "\r\n" around each chunk
+#define IMGUR_FOLLOW_POLL       50    // ms between two looks for data appended to a followed file
+#define IMGUR_STALL_TIMEOUT     5000  // ms without data from a File/Stream source before giving up
+#define IMGUR_RESPONSE_TIMEOUT  15000 // ms to wait for the complete server reply
+#define IMGUR_KEEPALIVE_IDLE    10000 // ms a kept-alive connection is trusted to still be open without traffic
+#define IMGUR_RESPONSE_MAXLEN   2048  // JSON reply bytes kept for parsing, the rest is discarded
+#define IMGUR_TOKEN_API_URL     "/oauth2/token"
+#define IMGUR_TOKEN_MARGIN      3600  // s before expiry when the access token gets refreshed
+#define IMGUR_CLOCK_VALID       1600000000 // epoch seconds, earlier means the clock isn't set
+#define IMGUR_MANIFEST_NAME     ".imgur_manifest" // kept in the uploaded directory
+#define IMGUR_MANIFEST_GROWTH   64    // manifest hashes allocated at once
+#define IMGUR_KEY_COOLDOWN      3600  // s before retrying an exhausted client ID when no reset time was given
 #define BOUNDARY                "blah-blah-oz"
 #define HEADER                  "--" BOUNDARY
 #define FOOTER                  "--" BOUNDARY "--"
 
 
-ImgurUploader::ImgurUploader(const char *appKey) : client(), appKey(appKey) { ; }
+ImgurUploader::ImgurUploader(const char *appKey) : ImgurUploader( &appKey, 1 ) { ; }
+
+
+ImgurUploader::ImgurUploader( const char* const* appKeys, uint8_t count ) : client() {
+  if( count > IMGUR_MAX_KEYS ) count = IMGUR_MAX_KEYS;
+  for( uint8_t i=0; i<count; i++ ) {
+    _keys[i] = { appKeys[i], -1, -1, 0 };
+  }
+  _keyCount   = count;
+  _keyIndex   = 0;
+  _oauthClientId = NULL;
+  _oauthSecret = NULL;
+  _accessToken[0]  = '\0';
+  _refreshToken[0] = '\0';
+  _tokenExpiry = 0;
+  _tokenFS    = NULL;
+  _tokenPath  = NULL;
+  _tokenReply = false;
+  appKey      = count > 0 ? appKeys[0] : "";
+  _progressCB = NULL;
+  _streamCB   = NULL;
+  _chunkCB    = NULL;
+  _chunkArg   = NULL;
+  _byteArray  = NULL;
+  _arrayLen   = 0;
+  _bodySent   = 0;
+  _chunked    = false;
+  _idleSince  = 0;
+  _chunkBuf   = NULL;
+  _reader     = NULL;
+  _ring       = NULL;
+  _segments   = NULL;
+  _segmentCount = 0;
+  _partition  = NULL;
+  _mapOffset  = 0;
+  _transformMaxDim  = 0;
+  _transformQuality = 0;
+  _transformBmp = false;
+  _frameFS      = NULL;
+  _framePaths   = NULL;
+  _frameCount   = 0;
+  _gifDelay   = 0;
+  _gifMaxDim  = 0;
+  _frameCB    = NULL;
+  _jpegFrameCB = NULL;
+  _videoFps   = 0;
+  _bmpQuality = 0;
+  _stripMetadata = false;
+  _stripKeep  = 0;
+  _strip      = false;
+  _sourceLen  = 0;
+  _changePercent   = 0;
+  _changeCellDelta = 0;
+  _maxSkipMs  = 0;
+  _lastChangeMs = 0;
+  _deliveryBudget = 0;
+  _throughput = 0;
+  _overheadMs = 0;
+  _bppFactor  = 1.0f;
+  _stallTimeout = IMGUR_STALL_TIMEOUT;
+  _uploadId   = 0;
+  _reservedId = 0;
+  _cancelId   = 0;
+  _lastId     = 0;
+  _followEnded = false;
+  _followDrained = false;
+  _followFS   = NULL;
+  _followPath = NULL;
+  _followPos  = 0;
+  _followPolled = 0;
+  _rateLimit  = 0;
+  _rateBurst  = 0;
+  _rateTokens = 0;
+  _rateRefillMs = 0;
+  URL[0]      = '\0';
+  memset( &_result, 0, sizeof(_result) );
+  _albumURL[0]   = '\0';
+  _albumId[0]    = '\0';
+  _albumDeleteHash[0] = '\0';
+  _album      = NULL;
+  _method     = NULL;
+  _apiPath    = NULL;
+  memset( &_status, 0, sizeof(_status) );
+  _retryPolicy = { 3, 500, 8000, 10 };
+  _retryTokens = _retryPolicy.budget;
+}
 
 
 void ImgurUploader::setProgressCallback( void (*progressCB)(byte progress) ) {
   _progressCB = progressCB;
 }
 
+
+void ImgurUploader::setRetryPolicy( const RetryPolicy &policy ) {
+  _retryPolicy = policy;
+  if( _retryPolicy.maxAttempts == 0 ) _retryPolicy.maxAttempts = 1;
+  _retryTokens = _retryPolicy.budget;
+}
+
+
+void ImgurUploader::setTransform( uint16_t maxDimension, uint8_t quality ) {
+  _transformMaxDim = maxDimension;
+  _transformQuality = quality > 100 ? 100 : quality;
+}
+
+
+void ImgurUploader::setBmpTranscode( uint8_t quality ) {
+  _bmpQuality = quality > 100 ? 100 : quality;
+}
+
+
+void ImgurUploader::setBandwidthLimit( uint32_t bytesPerSec, uint32_t burstBytes ) {
+  _rateBurst = burstBytes;
+  _rateLimit = bytesPerSec;
+}
+
+
+void ImgurUploader::setStripMetadata( bool strip, uint8_t keep ) {
+  _stripMetadata = strip;
+  _stripKeep = keep;
+}
+
+
+void ImgurUploader::setChangeDetection( uint8_t minChangedPercent, uint8_t cellDelta, uint32_t maxSkipSeconds ) {
+  _changePercent = minChangedPercent > 100 ? 100 : minChangedPercent;
+  _changeCellDelta = cellDelta;
+  _maxSkipMs = maxSkipSeconds * 1000;
+  _lastSignature.valid = false;
+}
+
+
+// percent-encodes value for an application/x-www-form-urlencoded body, false if it doesn't fit
+static bool formEncode( char* out, size_t outLen, const char* value ) {
+  static const char hex[] = "0123456789ABCDEF";
+  size_t pos = 0;
+  for( ; *value; value++ ) {
+    uint8_t c = *value;
+    if( isalnum( c ) || c == '-' || c == '_' || c == '.' || c == '~' ) {
+      if( pos + 1 >= outLen ) return false;
+      out[pos++] = c;
+    } else {
+      if( pos + 3 >= outLen ) return false;
+      out[pos++] = '%';
+      out[pos++] = hex[c >> 4];
+      out[pos++] = hex[c & 15];
+    }
+  }
+  out[pos] = '\0';
+  return true;
+}
+
+
+static uint32_t uptimeSeconds() {
+  return esp_timer_get_time() / 1000000;
+}
+
+
+void ImgurUploader::setOAuth( const char* clientId, const char* clientSecret, const char* refreshToken, fs::FS* cacheFS, const char* cachePath ) {
+  _oauthClientId = clientId;
+  _oauthSecret = clientSecret;
+  _tokenFS = cacheFS;
+  _tokenPath = cachePath;
+  strlcpy( _refreshToken, refreshToken, sizeof(_refreshToken) );
+  _accessToken[0] = '\0';
+  _tokenExpiry = 0;
+  if( _tokenFS == NULL || !_tokenFS->exists( _tokenPath ) ) return;
+  File cache = _tokenFS->open( _tokenPath );
+  StaticJsonDocument<384> doc;
+  if( !cache || deserializeJson( doc, cache ) ) {
+    log_n("Unreadable token cache %s", _tokenPath);
+    return;
+  }
+  cache.close();
+  strlcpy( _accessToken, doc["access_token"] | "", sizeof(_accessToken) );
+  // refresh tokens may be rotated, the cached one is the latest
+  strlcpy( _refreshToken, doc["refresh_token"] | refreshToken, sizeof(_refreshToken) );
+  uint32_t expiresAt = doc["expires_at"] | 0;
+  time_t now = time( NULL );
+  if( expiresAt > 0 && now > IMGUR_CLOCK_VALID ) {
+    // remaining lifetime from the wall clock, if the clock isn't set yet the token is
+    // used as is and refreshed at the next maintainToken()
+    _tokenExpiry = expiresAt > now ? uptimeSeconds() + ( expiresAt - now ) : 1;
+  }
+  log_d("Using cached access token, expiry %s", _tokenExpiry > 0 ? "known" : "unknown");
+}
+
+
+void ImgurUploader::saveToken() {
+  if( _tokenFS == NULL ) return;
+  StaticJsonDocument<384> doc;
+  doc["access_token"]  = _accessToken;
+  doc["refresh_token"] = _refreshToken;
+  time_t now = time( NULL );
+  doc["expires_at"] = now > IMGUR_CLOCK_VALID && _tokenExpiry > 0 ? (uint32_t)( now + _tokenExpiry - uptimeSeconds() ) : 0;
+  File cache = _tokenFS->open( _tokenPath, FILE_WRITE );
+  if( !cache || serializeJson( doc, cache ) == 0 ) {
+    log_n("Could not write token cache %s", _tokenPath);
+  }
+  cache.close();
+}
+
+
+// the token is missing, close to expiry, or of unknown age
+bool ImgurUploader::tokenDue() {
+  return _accessToken[0] == '\0' || _tokenExpiry == 0 || uptimeSeconds() + IMGUR_TOKEN_MARGIN >= _tokenExpiry;
+}
+
+
+bool ImgurUploader::maintainToken( bool force ) {
+  if( _oauthClientId == NULL || !( force || tokenDue() ) ) return true;
+  UploadStatus saved = _status;
+  uint32_t reserved = _reservedId; // meant for the next upload, not for this refresh
+  bool ok = refreshAccessToken();
+  _reservedId = reserved;
+  _status = saved;
+  return ok;
+}
+
+
+// POST oauth2/token on the (kept-alive) API connection, a second try covers a connection closed by the server
+bool ImgurUploader::refreshAccessToken() {
+  char form[256];
+  char encoded[3][96];
+  if( !formEncode( encoded[0], sizeof(encoded[0]), _refreshToken ) || !formEncode( encoded[1], sizeof(encoded[1]), _oauthClientId )
+   || !formEncode( encoded[2], sizeof(encoded[2]), _oauthSecret ) ) {
+    log_n("OAuth credentials are too long");
+    fail( PHASE_SOURCE, false );
+    return false;
+  }
+  int formLen = snprintf( form, sizeof(form), "refresh_token=%s&client_id=%s&client_secret=%s&grant_type=refresh_token", encoded[0], encoded[1], encoded[2] );
+  if( formLen >= (int)sizeof(form) ) {
+    log_n("OAuth credentials are too long");
+    fail( PHASE_SOURCE, false );
+    return false;
+  }
+  int ret = -1;
+  for( uint8_t attempt=0; attempt<2 && ret <= 0; attempt++ ) {
+    resetAttempt();
+    if( !connect() ) break;
+    char request[256];
+    int requestLen = snprintf( request, sizeof(request),
+      "POST " IMGUR_TOKEN_API_URL " HTTP/1.1\r\n"
+      "Host: " IMGUR_UPLOAD_API_DOMAIN "\r\n"
+      "Connection: keep-alive\r\n"
+      "Content-Type: application/x-www-form-urlencoded\r\n"
+      "Content-Length: %d\r\n"
+      "\r\n", formLen );
+    if( client.write( (const uint8_t*)request, requestLen ) != (size_t)requestLen || client.write( (const uint8_t*)form, formLen ) != (size_t)formLen ) {
+      client.stop();
+      fail( PHASE_SEND, true );
+      continue;
+    }
+    _tokenReply = true;
+    ret = readResponse();
+    _tokenReply = false;
+    if( _status.httpCode != 0 ) break; // the server answered, trying again won't change it
+  }
+  if( ret <= 0 ) {
+    log_n("Access token refresh failed (phase %d, HTTP %d)", _status.phase, _status.httpCode);
+    return false;
+  }
+  saveToken();
+  return true;
+}
+
+
+int ImgurUploader::parseToken( const char* body, size_t len ) {
+  int code = _status.httpCode;
+  if( code < 200 || code >= 300 ) {
+    log_n("Token refresh failed with HTTP %d", code );
+    return fail( PHASE_HTTP, code == 408 || code == 429 || code >= 500 );
+  }
+  StaticJsonDocument<96> filter;
+  filter["access_token"]  = true;
+  filter["refresh_token"] = true;
+  filter["expires_in"]    = true;
+  StaticJsonDocument<384> doc;
+  if( deserializeJson( doc, body, len, DeserializationOption::Filter( filter ) ) || !doc["access_token"].is<const char*>() ) {
+    log_n("Unexpected token response: %s", body );
+    return fail( PHASE_RESPONSE, true );
+  }
+  strlcpy( _accessToken, doc["access_token"].as<const char*>(), sizeof(_accessToken) );
+  if( doc["refresh_token"].is<const char*>() ) strlcpy( _refreshToken, doc["refresh_token"].as<const char*>(), sizeof(_refreshToken) );
+  uint32_t expiresIn = doc["expires_in"] | 0;
+  _tokenExpiry = expiresIn > 0 ? uptimeSeconds() + expiresIn : 0;
+  log_d("Access token refreshed, expires in %d s", expiresIn);
+  _status.phase = PHASE_DONE;
+  return 1;
+}
+
+
+// value of the Authorization header: the user's bearer token, or the client ID of the current key
+const char* ImgurUploader::authorization( char* buf, size_t len ) {
+  if( _oauthClientId != NULL && _accessToken[0] != '\0' ) {
+    snprintf( buf, len, "Bearer %s", _accessToken );
+  } else {
+    snprintf( buf, len, "Client-ID %s", appKey );
+  }
+  return buf;
+}
+
+
+void ImgurUploader::end() {
+  client.stop();
+}
+
+
 static byte lastprogress = 0;
 void defaultProgressCallback( byte progress ) {
   if( lastprogress != progress ) {
@@ -60,15 +383,36 @@ void defaultProgressCallback( byte progress ) {
 
 
 int ImgurUploader::uploadFile( fs::FS &fs, const char* path ) {
+  memset( &_status, 0, sizeof(_status) );
   _sourceFile = fs.open( path );
   if( !_sourceFile ) {
     log_n("Could not open path %s", path );
-    return -1;
+    return fail( PHASE_SOURCE, false );
   }
   _source = SOURCE_FILE;
   const char* fileName = _sourceFile.name();
   _arrayLen = _sourceFile.size();
   const char* mimeType = getMimeType( fileName );
+  bool isJpeg = strcmp( mimeType, "image/jpeg" ) == 0;
+  bool isBmp  = strcmp( mimeType, "image/x-windows-bmp" ) == 0;
+  _signature.valid = false;
+  if( _changePercent > 0 && ( isJpeg || isBmp ) && unchanged( isBmp ) ) {
+    log_n("%s looks like the last upload, skipped", fileName);
+    _sourceFile.close();
+    _status.phase = PHASE_SKIPPED;
+    _reservedId = 0; // that upload is over
+    return 0;
+  }
+  bool overBudget = _deliveryBudget > 0 && _throughput > 0 && ( (uint64_t)_arrayLen * 1000 ) / _throughput + _overheadMs > _deliveryBudget;
+  // RLE or paletted bitmaps below 8 bits can't be decoded, they go as they are, with their own MIME type
+  bool bmpTranscode = isBmp && ( _bmpQuality > 0 || _transformQuality > 0 || overBudget ) && imgurBmpSupported( _sourceFile );
+  if( ( isJpeg && ( _transformQuality > 0 || overBudget ) ) || bmpTranscode ) {
+    _source = SOURCE_TRANSFORM;
+    _transformBmp = isBmp;
+    _arrayLen = 0; // encoded size isn't known in advance, sent chunked
+    mimeType = "image/jpeg";
+  }
+  _strip = _source == SOURCE_FILE && isJpeg && _stripMetadata && prepareStrip();
   return upload( fileName, mimeType );
 }
 
@@ -79,10 +423,226 @@ int ImgurUploader::uploadBytes( const uint8_t* byteArray, size_t arrayLen, const
   _arrayLen = arrayLen;
   const char* mimeType = getMimeType( imageName );
   //String fileName = String( imageName );
+  _strip = _stripMetadata && strcmp( mimeType, "image/jpeg" ) == 0 && prepareStrip();
   return upload( imageName, mimeType );
 }
 
 
+int ImgurUploader::uploadAlbum( fs::FS &fs, const char* const* paths, uint16_t count, UploadResult* results, const char* title ) {
+  char form[160] = "privacy=hidden";
+  if( title != NULL ) {
+    strcat( form, "&title=" );
+    size_t used = strlen( form );
+    if( !formEncode( form + used, sizeof(form) - used, title ) ) {
+      log_n("Album title is too long");
+      memset( &_status, 0, sizeof(_status) );
+      return fail( PHASE_SOURCE, false );
+    }
+  }
+  int ret = formRequest( "POST", IMGUR_ALBUM_API_URL, form );
+  if( ret <= 0 ) return ret;
+  snprintf( _albumURL, sizeof(_albumURL), IMGUR_ALBUM_URL_MASK, _result.id );
+  strlcpy( _albumId, _result.id, sizeof(_albumId) );
+  strlcpy( _albumDeleteHash, _result.deleteHash, sizeof(_albumDeleteHash) );
+  log_d("Created album %s", _albumURL);
+  // the connection is kept alive, images follow without a new handshake,
+  // anonymous albums are referenced by their deletehash, account albums by their id
+  _album = _oauthClientId != NULL ? _albumId : _albumDeleteHash;
+  int uploaded = 0;
+  for( uint16_t i=0; i<count; i++ ) {
+    ret = uploadFile( fs, paths[i] );
+    if( ret > 0 ) uploaded++;
+    if( results != NULL ) {
+      if( ret > 0 ) {
+        results[i] = _result;
+      } else {
+        memset( &results[i], 0, sizeof(results[i]) );
+        results[i].ret = ret;
+      }
+    }
+  }
+  _album = NULL;
+  return uploaded > 0 || count == 0 ? uploaded : ret;
+}
+
+
+int ImgurUploader::updateImage( const char* deleteHash, const char* title, const char* description ) {
+  char path[48];
+  char form[384] = "";
+  snprintf( path, sizeof(path), IMGUR_UPLOAD_API_URL "/%s", deleteHash );
+  const char* names[]  = { "title", "description" };
+  const char* values[] = { title, description };
+  for( uint8_t i=0; i<2; i++ ) {
+    if( values[i] == NULL ) continue;
+    size_t used = strlen( form );
+    int len = snprintf( form + used, sizeof(form) - used, "%s%s=", used > 0 ? "&" : "", names[i] );
+    used += len;
+    if( used >= sizeof(form) || !formEncode( form + used, sizeof(form) - used, values[i] ) ) {
+      log_n("Image %s is too long", names[i]);
+      memset( &_status, 0, sizeof(_status) );
+      return fail( PHASE_SOURCE, false );
+    }
+  }
+  return formRequest( "POST", path, form );
+}
+
+
+int ImgurUploader::deleteImage( const char* deleteHash ) {
+  char path[48];
+  snprintf( path, sizeof(path), IMGUR_UPLOAD_API_URL "/%s", deleteHash );
+  return formRequest( "DELETE", path, NULL );
+}
+
+
+// 64 bits FNV-1a of the path, size and modification time: a file edited or replaced under the same name is new,
+// and collisions, which would skip a file for good, stay negligible with many thousand files
+static uint64_t fileHash( const char* path, uint32_t size, uint32_t mtime ) {
+  uint64_t hash = 14695981039346656037ull;
+  for( ; *path; path++ ) hash = ( hash ^ (uint8_t)*path ) * 1099511628211ull;
+  uint32_t fields[2] = { size, mtime };
+  const uint8_t* bytes = (const uint8_t*)fields;
+  for( uint8_t i=0; i<sizeof(fields); i++ ) hash = ( hash ^ bytes[i] ) * 1099511628211ull;
+  return hash;
+}
+
+
+// hashes of the files listed in the manifest, only 8 bytes per file stay in RAM
+uint64_t* ImgurUploader::loadManifest( fs::FS &fs, const char* manifestPath, size_t &count ) {
+  count = 0;
+  uint64_t* hashes = NULL;
+  size_t capacity = 0;
+  File manifest = fs.open( manifestPath );
+  if( !manifest ) return NULL;
+  char head[17];
+  uint8_t headLen = 0;
+  int c;
+  while( ( c = manifest.read() ) >= 0 ) {
+    if( c != '\n' ) {
+      if( headLen < 16 ) head[headLen++] = c;
+      continue;
+    }
+    head[headLen] = '\0';
+    headLen = 0;
+    char* end;
+    uint64_t hash = strtoull( head, &end, 16 );
+    if( end != head + 16 ) continue; // damaged line, e.g. cut by a reset
+    if( count == capacity ) {
+      uint64_t* grown = (uint64_t*)realloc( hashes, ( capacity + IMGUR_MANIFEST_GROWTH ) * sizeof(uint64_t) );
+      if( grown == NULL ) {
+        log_e("Can't grow the manifest index past %d files", count);
+        break;
+      }
+      hashes = grown;
+      capacity += IMGUR_MANIFEST_GROWTH;
+    }
+    hashes[count++] = hash;
+  }
+  manifest.close();
+  return hashes;
+}
+
+
+int ImgurUploader::uploadDirectory( fs::FS &fs, const char* path, bool (*filter)( const char* path ) ) {
+  memset( &_status, 0, sizeof(_status) );
+  size_t pathLen = strlen( path );
+  File dir;
+  if( pathLen > 0 ) dir = fs.open( path );
+  if( !dir || !dir.isDirectory() ) {
+    log_n("Not a directory: %s", path );
+    return fail( PHASE_SOURCE, false );
+  }
+  const char* separator = path[pathLen-1] == '/' ? "" : "/";
+  char manifestPath[128];
+  char filePath[128];
+  snprintf( manifestPath, sizeof(manifestPath), "%s%s" IMGUR_MANIFEST_NAME, path, separator );
+  size_t known;
+  uint64_t* hashes = loadManifest( fs, manifestPath, known );
+  log_d("%d files listed in %s", known, manifestPath);
+  int uploaded = 0;
+  int ret = 0;
+  File entry;
+  while( ( entry = dir.openNextFile() ) ) {
+    // older cores give the full path as name, newer ones the base name
+    const char* name = entry.name();
+    if( name[0] == '/' ) {
+      strlcpy( filePath, name, sizeof(filePath) );
+    } else {
+      snprintf( filePath, sizeof(filePath), "%s%s%s", path, separator, name );
+    }
+    bool isFile = !entry.isDirectory();
+    uint32_t size = entry.size();
+    uint32_t mtime = entry.getLastWrite();
+    entry.close();
+    if( !isFile || strcmp( filePath, manifestPath ) == 0 ) continue;
+    if( filter ? !filter( filePath ) : strncmp( getMimeType( filePath ), "image/", 6 ) != 0 ) continue;
+    uint64_t hash = fileHash( filePath, size, mtime );
+    bool listed = false;
+    for( size_t i=0; i<known && !listed; i++ ) {
+      listed = hashes[i] == hash;
+    }
+    if( listed ) continue;
+    // the connection stays alive from one file to the next
+    int fileRet = uploadFile( fs, filePath );
+    if( fileRet <= 0 ) {
+      if( fileRet < 0 ) ret = fileRet;
+      continue;
+    }
+    uploaded++;
+    File manifest = fs.open( manifestPath, FILE_APPEND );
+    if( !manifest ) {
+      log_n("Could not append to %s", manifestPath);
+      continue;
+    }
+    // one line per upload, written right away so a reset loses at most the current file
+    manifest.printf( "%016llx " IMGUR_URL_MASK " %s %s\n", (unsigned long long)hash, _result.id, _result.deleteHash, filePath );
+    manifest.close();
+  }
+  dir.close();
+  free( hashes );
+  log_d("%d new files uploaded from %s", uploaded, path);
+  _reservedId = 0; // e.g. nothing new to upload
+  return uploaded > 0 || ret == 0 ? uploaded : ret;
+}
+
+
+int ImgurUploader::uploadURL( const char* imageURL ) {
+  memset( &_status, 0, sizeof(_status) );
+  if( strncmp( imageURL, "http://", 7 ) != 0 && strncmp( imageURL, "https://", 8 ) != 0 ) {
+    log_n("Not an http(s) URL: %s", imageURL );
+    return fail( PHASE_SOURCE, false );
+  }
+  _source = SOURCE_URL;
+  _byteArray = (uint8_t*)imageURL;
+  _arrayLen = strlen( imageURL );
+  return upload( NULL, NULL );
+}
+
+
+int ImgurUploader::uploadFollow( fs::FS &fs, const char* path, const char* imageName, const char* imageMimeType ) {
+  memset( &_status, 0, sizeof(_status) );
+  _followFS = &fs;
+  _followPath = path;
+  _followPos = 0; // left at the previous file's length otherwise
+  _followDrained = false;
+  if( !reopenFollow() ) {
+    log_n("Could not open path %s", path );
+    _followEnded = false;
+    return fail( PHASE_SOURCE, false );
+  }
+  if( imageName == NULL ) {
+    // not _sourceFile.name(), the file gets reopened
+    const char* slash = strrchr( path, '/' );
+    imageName = slash ? slash + 1 : path;
+  }
+  if( imageMimeType == NULL ) imageMimeType = getMimeType( imageName );
+  _source = SOURCE_FOLLOW;
+  _arrayLen = 0; // final size unknown, sent chunked
+  int ret = upload( imageName, imageMimeType );
+  _followEnded = false;
+  return ret;
+}
+
+
 int ImgurUploader::uploadStream( size_t arrayLen, void (*streamCB)(Stream* client), const char* imageName, const char* imageMimeType) {
   _source = SOURCE_STREAM;
   _arrayLen = arrayLen;
@@ -91,143 +651,1393 @@ int ImgurUploader::uploadStream( size_t arrayLen, void (*streamCB)(Stream* clien
 }
 
 
+int ImgurUploader::uploadFrom( Stream &src, size_t len, const char* imageName, const char* imageMimeType ) {
+  _source = SOURCE_READER;
+  _reader = &src;
+  _arrayLen = len;
+  return upload( imageName, imageMimeType );
+}
+
 
+int ImgurUploader::uploadRing( ImgurRingBuffer &ring, size_t len, const char* imageName, const char* imageMimeType ) {
+  _source = SOURCE_RING;
+  _ring = &ring;
+  _arrayLen = len;
+  return upload( imageName, imageMimeType );
+}
+
+
+int ImgurUploader::uploadSegments( const Segment* segments, size_t count, const char* imageName, const char* imageMimeType ) {
+  _source = SOURCE_SEGMENTS;
+  _segments = segments;
+  _segmentCount = count;
+  _arrayLen = 0;
+  for( size_t i=0; i<count; i++ ) {
+    _arrayLen += segments[i].len;
+  }
+  return upload( imageName, imageMimeType );
+}
+
+
+int ImgurUploader::uploadMapped( const char* partitionLabel, size_t offset, size_t len, const char* imageName, const char* imageMimeType ) {
+  memset( &_status, 0, sizeof(_status) );
+  _partition = esp_partition_find_first( ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, partitionLabel );
+  if( _partition == NULL || offset + len > _partition->size ) {
+    log_n("No partition %s or range out of bounds", partitionLabel );
+    return fail( PHASE_SOURCE, false );
+  }
+  _source = SOURCE_MAPPED;
+  _mapOffset = offset;
+  _arrayLen = len;
+  return upload( imageName, imageMimeType );
+}
+
+
+int ImgurUploader::uploadGif( fs::FS &fs, const char* const* paths, uint16_t count, uint16_t frameDelayMs, uint16_t maxDimension, const char* imageName ) {
+  _source = SOURCE_GIF;
+  _frameFS = &fs;
+  _framePaths = paths;
+  _frameCount = count;
+  _gifDelay = frameDelayMs;
+  _gifMaxDim = maxDimension;
+  _frameCB = NULL;
+  _arrayLen = 0; // encoded size isn't known in advance, sent chunked
+  return upload( imageName, "image/gif" );
+}
+
+
+int ImgurUploader::uploadGif( bool (*frameCB)( uint16_t frame, ImgurRowSink &sink ), uint16_t frameDelayMs, const char* imageName ) {
+  _source = SOURCE_GIF;
+  _framePaths = NULL;
+  _gifDelay = frameDelayMs;
+  _frameCB = frameCB;
+  _arrayLen = 0;
+  return upload( imageName, "image/gif" );
+}
+
+
+int ImgurUploader::uploadVideo( fs::FS &fs, const char* const* paths, uint16_t count, uint8_t fps, const char* videoName ) {
+  memset( &_status, 0, sizeof(_status) );
+  // frame sizes are all known, so is the video size: headers and index are exact and no chunking is needed
+  size_t framesSize = 0;
+  for( uint16_t i=0; i<count; i++ ) {
+    File frame = fs.open( paths[i] );
+    if( !frame ) {
+      log_n("Could not open path %s", paths[i] );
+      return fail( PHASE_SOURCE, false );
+    }
+    framesSize += ImgurAviMuxer::frameSize( frame.size() );
+    frame.close();
+  }
+  if( count == 0 || fps == 0 ) return fail( PHASE_SOURCE, false );
+  _source = SOURCE_VIDEO;
+  _frameFS = &fs;
+  _framePaths = paths;
+  _frameCount = count;
+  _videoFps = fps;
+  _jpegFrameCB = NULL;
+  _arrayLen = ImgurAviMuxer::fileSize( framesSize );
+  return upload( videoName, "video/x-msvideo" );
+}
+
+
+int ImgurUploader::uploadVideo( bool (*frameCB)( uint16_t frame, const uint8_t* &data, size_t &len ), uint8_t fps, const char* videoName ) {
+  memset( &_status, 0, sizeof(_status) );
+  if( fps == 0 ) return fail( PHASE_SOURCE, false );
+  _source = SOURCE_VIDEO;
+  _framePaths = NULL;
+  _videoFps = fps;
+  _jpegFrameCB = frameCB;
+  _arrayLen = 0; // sent chunked
+  return upload( videoName, "video/x-msvideo" );
+}
+
+
+uint32_t ImgurUploader::reserveUploadId() {
+  uint32_t id = ++_lastId;
+  if( id == 0 ) id = ++_lastId;
+  _reservedId = id;
+  return id;
+}
+
+
+// runs attempts until success, a permanent failure, or an exhausted retry budget
 int ImgurUploader::upload( const char* imageName, const char* imageMimeType ) {
   int ret = -1;
-  int mimeTypeLen = strlen( imageMimeType );
-  int nameLen = strlen( imageName );
+  memset( &_status, 0, sizeof(_status) );
+  // a reserved id may have been cancelled already
+  uint32_t reserved = _reservedId.exchange( 0 );
+  _uploadId = reserved != 0 ? reserved : reserveUploadId();
+  _reservedId = 0;
+  _chunked = _arrayLen == 0 && _source != SOURCE_FORM;
+  if( _chunked ) {
+    _chunkBuf = (uint8_t*)malloc( IMGUR_BUFFSIZE + IMGUR_CHUNK_FRAMING );
+    if( _chunkBuf == NULL ) {
+      log_e("Can't alloc %d bytes, aborting", IMGUR_BUFFSIZE + IMGUR_CHUNK_FRAMING);
+      _uploadId = 0;
+      return fail( PHASE_SOURCE, true );
+    }
+  }
+  bool authorized = !cancelled();
+  if( !authorized ) {
+    // cancelled before it started
+    ret = fail( PHASE_CANCELLED, false );
+  } else if( _oauthClientId != NULL && ( _accessToken[0] == '\0' || ( _tokenExpiry != 0 && uptimeSeconds() >= _tokenExpiry ) ) ) {
+    // maintainToken() wasn't called in time, this upload has to wait for a fresh token
+    authorized = refreshAccessToken();
+    if( authorized ) memset( &_status, 0, sizeof(_status) );
+    else ret = -_status.phase;
+  }
+  bool reauthorized = false;
+  while( authorized ) {
+    if( client.connected() && ( !replayable() || millis() - _idleSince > IMGUR_KEEPALIVE_IDLE ) ) {
+      // the server may have closed it meanwhile, that's only found out once the body is sent:
+      // free to retry for a source that can be read again, lost data otherwise
+      log_d("not reusing the kept-alive connection");
+      client.stop();
+    }
+    bool reused = client.connected();
+    _status.attempts++;
+    if( !pickKey() ) {
+      ret = -_status.phase;
+    } else {
+      ret = _source == SOURCE_FORM ? formAttempt() : uploadAttempt( imageName, imageMimeType );
+    }
+    if( ret > 0 ) {
+      if( _retryTokens < _retryPolicy.budget ) _retryTokens++;
+      break;
+    }
+    if( cancelled() ) {
+      // whatever failed, it failed because of the cancellation
+      client.stop();
+      ret = fail( PHASE_CANCELLED, false );
+      break;
+    }
+    if( _oauthClientId != NULL && !reauthorized && ( _status.httpCode == 401 || _status.httpCode == 403 ) && rewindSource() ) {
+      // the access token was revoked or expired early
+      reauthorized = true;
+      UploadStatus rejected = _status;
+      if( refreshAccessToken() ) {
+        _status = rejected;
+        continue;
+      }
+      _status = rejected;
+    }
+    if( !_status.retriable || !rewindSource() ) break;
+    if( reused && ( _status.phase == PHASE_SEND || _status.phase == PHASE_RESPONSE ) && _status.httpCode == 0 ) {
+      // the server silently closed the kept-alive connection, reconnect for free
+      log_d("stale connection, reconnecting");
+      _status.attempts--;
+      continue;
+    }
+    if( _status.attempts >= _retryPolicy.maxAttempts ) break;
+    uint8_t limited = _keyIndex;
+    if( _status.httpCode == 429 && _oauthClientId == NULL && _keyCount > 1 && pickKey() ) {
+      // another client ID still has quota, no need to wait
+      log_n("Client ID #%d is rate limited, switching to #%d", limited, _keyIndex );
+      continue;
+    }
+    if( _retryTokens == 0 ) {
+      log_n("Retry budget exhausted, giving up");
+      break;
+    }
+    uint32_t wait;
+    if( !retryDelay( wait ) ) {
+      log_n("Server asked to retry after %d seconds, giving up", _status.retryAfter );
+      break;
+    }
+    _retryTokens--;
+    log_n("Attempt #%d failed (phase %d, HTTP %d), retrying in %d ms", _status.attempts, _status.phase, _status.httpCode, wait );
+    if( !pause( wait ) ) {
+      ret = fail( PHASE_CANCELLED, false );
+      break;
+    }
+  }
+  if( _source == SOURCE_FILE || _source == SOURCE_TRANSFORM || _source == SOURCE_FOLLOW ) _sourceFile.close();
+  if( ret > 0 && _signature.valid ) {
+    _lastSignature = _signature;
+    _lastChangeMs = millis();
+  }
+  _signature.valid = false;
+  free( _chunkBuf );
+  _chunkBuf = NULL;
+  _uploadId = 0;
+  return ret;
+}
 
-  if (WiFi.status() != WL_CONNECTED) {
+
+void ImgurUploader::resetAttempt() {
+  _status.phase      = PHASE_NONE;
+  _status.httpCode   = 0;
+  _status.apiCode    = 0;
+  _status.error[0]   = '\0';
+  _status.retriable  = false;
+  _status.retryAfter = 0;
+  _status.sendMs     = 0;
+  _status.bodySize   = 0;
+}
+
+
+int ImgurUploader::uploadAttempt( const char* imageName, const char* imageMimeType ) {
+  resetAttempt();
+  uint32_t attemptStart = millis();
+
+  if( !connect() ) {
+    return -_status.phase;
+  }
+  log_d("posting image ...");
+
+  const char postamble[] = "\r\n" FOOTER "\r\n\r\n";
+  char preamble[384];
+  int preambleLen = 0;
+  if( _album != NULL ) {
+    preambleLen = snprintf( preamble, sizeof(preamble),
+      HEADER "\r\n"
+      "Content-Disposition: form-data; name=\"album\"\r\n"
+      "\r\n"
+      "%s\r\n", _album );
+    if( preambleLen >= (int)sizeof(preamble) ) {
+      log_n("Album id is too long");
+      return fail( PHASE_SOURCE, false );
+    }
+  }
+  if( _source == SOURCE_URL ) {
+    // the image field holds the URL as plain text
+    preambleLen += snprintf( preamble + preambleLen, sizeof(preamble) - preambleLen,
+      HEADER "\r\n"
+      "Content-Disposition: form-data; name=\"type\"\r\n"
+      "\r\n"
+      "url\r\n"
+      HEADER "\r\n"
+      "Content-Disposition: form-data; name=\"image\"\r\n"
+      "\r\n" );
+  } else {
+    preambleLen += snprintf( preamble + preambleLen, sizeof(preamble) - preambleLen,
+      HEADER "\r\n"
+      "Content-Disposition: form-data; name=\"image\"; filename=\"%s\"\r\n"
+      "Content-Type: %s\r\n"
+      "\r\n", imageName, imageMimeType );
+  }
+  if( preambleLen >= (int)sizeof(preamble) ) {
+    log_n("Image name is too long");
+    return fail( PHASE_SOURCE, false );
+  }
+  uint32_t length = preambleLen + _arrayLen + sizeof(postamble) - 1;
+
+  // send headers and multipart preamble as a single TLS record
+  char request[640];
+  char contentLength[32];
+  if( _chunked ) {
+    snprintf( contentLength, sizeof(contentLength), "Transfer-Encoding: chunked" );
+  } else {
+    snprintf( contentLength, sizeof(contentLength), "Content-Length: %u", length );
+  }
+  char auth[80];
+  int requestLen = snprintf( request, sizeof(request),
+    "POST " IMGUR_UPLOAD_API_URL " HTTP/1.1\r\n"
+    "Authorization: %s\r\n"
+    "Host: " IMGUR_UPLOAD_API_DOMAIN "\r\n"
+    "Connection: keep-alive\r\n"
+    "Content-Type: multipart/form-data; boundary=" BOUNDARY "\r\n"
+    "%s\r\n"
+    "\r\n"
+    "%s", authorization( auth, sizeof(auth) ), contentLength, _chunked ? "" : preamble );
+  if( requestLen >= (int)sizeof(request) ) {
+    // snprintf() truncated it, writing requestLen bytes would read past the buffer
+    log_n("Request headers are too long (%d bytes)", requestLen);
+    return fail( PHASE_SOURCE, false );
+  }
+  bool sent = client.write( (const uint8_t*)request, requestLen ) == (size_t)requestLen;
+  if( sent && _chunked ) sent = writePacket( (const uint8_t*)preamble, preambleLen );
+  if( !sent ) {
+    log_n("Connection lost while sending headers");
+    client.stop();
+    return fail( PHASE_SEND, true );
+  }
+  uint32_t sendStart = millis();
+  if( !sendImageData() ) {
+    client.stop();
+    return -_status.phase;
+  }
+  sent = writePacket( (const uint8_t*)postamble, sizeof(postamble) - 1 );
+  if( sent && _chunked ) sent = client.write( (const uint8_t*)"0\r\n\r\n", 5 ) == 5; // last chunk
+  if( !sent ) {
+    log_n("Connection lost while sending footer");
+    client.stop();
+    return fail( PHASE_SEND, true );
+  }
+  _status.sendMs   = millis() - sendStart;
+  _status.bodySize = _bodySent;
+  int ret = readResponse();
+  _status.elapsedMs = millis() - attemptStart;
+  if( ret > 0 ) measureThroughput();
+  return ret;
+}
+
+
+// API calls other than uploads go through the same retry loop
+int ImgurUploader::formRequest( const char* method, const char* path, const char* form ) {
+  _source = SOURCE_FORM;
+  _method = method;
+  _apiPath = path;
+  _byteArray = (uint8_t*)form;
+  _arrayLen = form != NULL ? strlen( form ) : 0;
+  return upload( NULL, NULL );
+}
+
+
+int ImgurUploader::formAttempt() {
+  resetAttempt();
+  uint32_t attemptStart = millis();
+  if( !connect() ) {
+    return -_status.phase;
+  }
+  char request[512];
+  char auth[80];
+  int requestLen = snprintf( request, sizeof(request),
+    "%s %s HTTP/1.1\r\n"
+    "Authorization: %s\r\n"
+    "Host: " IMGUR_UPLOAD_API_DOMAIN "\r\n"
+    "Connection: keep-alive\r\n"
+    "Content-Type: application/x-www-form-urlencoded\r\n"
+    "Content-Length: %u\r\n"
+    "\r\n", _method, _apiPath, authorization( auth, sizeof(auth) ), _arrayLen );
+  if( requestLen >= (int)sizeof(request) ) {
+    log_n("Request headers are too long (%d bytes)", requestLen);
+    return fail( PHASE_SOURCE, false );
+  }
+  _bodySent = 0;
+  bool sent = client.write( (const uint8_t*)request, requestLen ) == (size_t)requestLen;
+  if( sent && _arrayLen > 0 ) sent = writePacket( _byteArray, _arrayLen );
+  if( !sent ) {
+    log_n("Connection lost while sending %s %s", _method, _apiPath);
+    client.stop();
+    return fail( PHASE_SEND, true );
+  }
+  int ret = readResponse();
+  _status.elapsedMs = millis() - attemptStart;
+  return ret;
+}
+
+
+// moving averages of the uplink throughput and of the per-upload overhead
+void ImgurUploader::measureThroughput() {
+  uint32_t overhead = _status.elapsedMs - _status.sendMs;
+  _overheadMs = _overheadMs ? ( _overheadMs * 7 + overhead * 3 ) / 10 : overhead;
+  if( _status.bodySize < IMGUR_MEASURE_MIN_BYTES ) return;
+  uint32_t sample = ( (uint64_t)_status.bodySize * 1000 ) / ( _status.sendMs ? _status.sendMs : 1 );
+  _throughput = _throughput ? ( (uint64_t)_throughput * 7 + (uint64_t)sample * 3 ) / 10 : sample;
+  log_d("Throughput: %d bytes/s (last upload %d bytes/s), overhead %d ms", _throughput, sample, _overheadMs);
+}
+
+
+// typical bits per pixel of a 4:2:0 JPEG at a given quality
+static float jpegBitsPerPixel( uint8_t quality ) {
+  static const float bpp[11] = { 0.3f, 0.45f, 0.55f, 0.65f, 0.75f, 0.85f, 0.95f, 1.1f, 1.4f, 2.1f, 5.0f }; // quality 0, 10, ... 100
+  uint8_t i = quality / 10;
+  if( i >= 10 ) return bpp[10];
+  return bpp[i] + ( bpp[i+1] - bpp[i] ) * ( quality % 10 ) / 10.0f;
+}
+
+
+// best resolution/quality whose estimated size can be sent within the delivery budget
+void ImgurUploader::pickQuality( uint16_t width, uint16_t height, uint16_t &maxDim, uint8_t &quality ) {
+  uint32_t budgetMs = _deliveryBudget > _overheadMs * 2 ? _deliveryBudget - _overheadMs : _deliveryBudget / 2;
+  float budgetBytes = (float)_throughput * budgetMs / 1000;
+  uint16_t largest = width > height ? width : height;
+  uint16_t dim = maxDim > 0 && maxDim < largest ? maxDim : largest;
+  while( true ) {
+    float ratio = (float)dim / largest;
+    float pixels = (float)width * height * ratio * ratio;
+    uint8_t lowest = dim > IMGUR_ADAPTIVE_MIN_DIM ? 50 : 20; // shrink before going below quality 50
+    if( lowest > quality ) lowest = quality;
+    // signed and clamped: a quality below the step can't wrap around, and the floor itself is tried
+    for( int16_t q=quality; ; q-=10 ) {
+      if( q < lowest ) q = lowest;
+      if( pixels * jpegBitsPerPixel( q ) * _bppFactor / 8 <= budgetBytes ) {
+        log_d("Delivery budget %d ms: %dpx at quality %d", _deliveryBudget, dim, q);
+        maxDim = dim;
+        quality = q;
+        return;
+      }
+      if( q == lowest ) break;
+    }
+    if( dim <= IMGUR_ADAPTIVE_MIN_DIM ) {
+      log_n("Delivery budget can't be met, sending %dpx at quality %d", dim, lowest);
+      maxDim = dim;
+      quality = lowest;
+      return;
+    }
+    dim = dim * 3 / 4;
+    if( dim < IMGUR_ADAPTIVE_MIN_DIM ) dim = IMGUR_ADAPTIVE_MIN_DIM;
+  }
+}
+
+
+bool ImgurUploader::connect() {
+  if( WiFi.status() != WL_CONNECTED ) {
     log_n("WiFi Not connected!");
-    return ret;
+    fail( PHASE_WIFI, true );
+    return false;
+  }
+  if( client.connected() ) {
+    log_d("reusing kept-alive connection");
+    return true;
+  }
+  client.stop();
+  IPAddress ip;
+  if( !WiFi.hostByName( IMGUR_UPLOAD_API_DOMAIN, ip ) ) {
+    log_n("DNS lookup failed!");
+    fail( PHASE_DNS, true );
+    return false;
   }
   log_d("connecting ...");
   client.setCACert( api_imgur_com_ca );
   // client.setCACert( NULL ); // YOLO Mode enabled
-  if (!client.connect("api.imgur.com", 443)) {
+  if (!client.connect(IMGUR_UPLOAD_API_DOMAIN, 443)) {
     log_n("Connection failed!");
-    return ret;
+    fail( PHASE_CONNECT, true );
+    return false;
   }
-  log_d("posting image ...");
-  uint32_t length = 16 + 56 + nameLen + 3 + 16 + mimeTypeLen + 2 + _arrayLen + 2 + 18 + 2;
-  client.println( "POST " IMGUR_UPLOAD_API_URL " HTTP/1.0" );
-  client.print( "Authorization: Client-ID " );
-  client.println( appKey );
-  client.println( "Host: " IMGUR_UPLOAD_API_DOMAIN );
-  client.println( "Content-Type: multipart/form-data; boundary=" BOUNDARY );
-  client.print( "Content-Length: " );
-  client.println( length );
-  client.println();
-  client.println( HEADER ); // 14+2
-  client.print( "Content-Disposition: form-data; name=\"image\"; filename=\""); // 56
-  client.print( imageName ); // nameLen
-  client.println("\"" ); // 1+2
-  client.print( "Content-Type: " ); // 14
-  client.println( imageMimeType ); // mimeTypeLen
-  client.println(); // +2
-  sendImageData();
-  client.println(); // +2
-  client.println( FOOTER ); // 16+2
-  client.println(); // +2
-  ret = readResponse();
-  client.stop();
-  log_d("connection closed");
-  return ret;
+  return true;
 }
 
 
-void ImgurUploader::sendImageData() {
-  uint8_t *buf = (uint8_t*)calloc( IMGUR_BUFFSIZE+1, sizeof(uint8_t) );
-  if( buf == NULL ) {
-    log_e("Can't alloc %d bytes, aborting", IMGUR_BUFFSIZE+1);
-    return;
+// routes the next attempt to the usable client ID with the most headroom, fails like a 429 when none is left
+bool ImgurUploader::pickKey() {
+  if( _oauthClientId != NULL ) return true; // bearer auth, the client IDs aren't sent
+  uint32_t now = millis();
+  int best = -1;
+  int32_t bestHeadroom = 0;
+  uint32_t soonest = UINT32_MAX;
+  for( uint8_t i=0; i<_keyCount; i++ ) {
+    KeyState &key = _keys[i];
+    if( key.coolUntil != 0 ) {
+      int32_t wait = key.coolUntil - now;
+      if( wait > 0 ) {
+        if( (uint32_t)wait < soonest ) soonest = wait;
+        continue;
+      }
+      // reset time passed, quota is unknown again
+      key.coolUntil = 0;
+      key.clientRemaining = -1;
+      key.postRemaining = -1;
+    }
+    int32_t headroom = INT32_MAX;
+    if( key.clientRemaining >= 0 && key.clientRemaining < headroom ) headroom = key.clientRemaining;
+    if( key.postRemaining >= 0 && key.postRemaining < headroom ) headroom = key.postRemaining;
+    if( best < 0 || headroom > bestHeadroom ) {
+      best = i;
+      bestHeadroom = headroom;
+    }
+  }
+  if( best < 0 ) {
+    log_n("All %d client IDs are rate limited", _keyCount);
+    _status.httpCode = 429;
+    _status.retryAfter = ( soonest + 999 ) / 1000;
+    strlcpy( _status.error, "All client IDs are rate limited", sizeof(_status.error) );
+    fail( PHASE_HTTP, true );
+    return false;
+  }
+  _keyIndex = best;
+  appKey = _keys[best].id;
+  _status.keyIndex = best;
+  return true;
+}
+
+
+// quota headers of the last reply, -1 when absent
+void ImgurUploader::updateKey( int32_t clientRemaining, int32_t postRemaining, uint32_t resetSeconds ) {
+  if( _oauthClientId != NULL ) return; // the limits are the account's, a 429 goes through the retry policy
+  KeyState &key = _keys[_keyIndex];
+  if( clientRemaining >= 0 ) key.clientRemaining = clientRemaining;
+  if( postRemaining >= 0 ) key.postRemaining = postRemaining;
+  if( _status.httpCode == 429 || key.clientRemaining == 0 || key.postRemaining == 0 ) {
+    uint32_t cooldown = _status.retryAfter > 0 ? _status.retryAfter : resetSeconds;
+    if( cooldown == 0 ) {
+      // no reset time given and no other key to switch to: the retry policy's backoff decides, as without a key ring
+      if( _keyCount == 1 ) return;
+      cooldown = IMGUR_KEY_COOLDOWN;
+    }
+    key.coolUntil = millis() + cooldown * 1000;
+    if( key.coolUntil == 0 ) key.coolUntil = 1;
+    log_d("Client ID #%d exhausted, cooling down for %d s", _keyIndex, cooldown);
   }
-  size_t packets = 0;
-  size_t _progress = 0;
+}
+
+
+int ImgurUploader::fail( UploadPhase phase, bool retriable ) {
+  _status.phase = phase;
+  _status.retriable = retriable;
+  // failing before upload() started: the call an id was reserved for is over
+  if( _uploadId == 0 ) _reservedId = 0;
+  return -phase;
+}
+
+
+bool ImgurUploader::rewindSource() {
   switch( _source ) {
-    case SOURCE_STREAM:
-      if( _streamCB ) {
-        _streamCB( &client );
-      } else {
-        log_n("Stream method requested but no valid callback was defined!");
-      }
-    break;
     case SOURCE_FILE:
-      {
-        log_d("Using filesystem");
-        size_t total = 0;
-        while( (packets = _sourceFile.read( buf, sizeof(buf))) > 0 ) {
-          client.write( buf, packets );
-          //log_w("Sent %d bytes", packets);
-          total+=packets;
-          _progress = (total*100) / _arrayLen;
-          if( _progressCB ) _progressCB( _progress );
-          else defaultProgressCallback( _progress );
-        }
-        _sourceFile.close();
-      }
-    break;
+    case SOURCE_TRANSFORM:  return _sourceFile.seek( 0 );
+    case SOURCE_FOLLOW:     _followPos = 0; return reopenFollow(); // what was written so far is still on file
+    case SOURCE_BYTE_ARRAY:
+    case SOURCE_URL:
+    case SOURCE_FORM:
+    case SOURCE_SEGMENTS:
+    case SOURCE_MAPPED:     return true;
+    case SOURCE_GIF:
+    case SOURCE_VIDEO:      return _framePaths != NULL || _status.phase < PHASE_SEND; // frame files are read again
+    default:                return _status.phase < PHASE_SEND; // streams can't be replayed once read
+  }
+}
+
+
+// whether the body can be sent again from its start after it was read
+bool ImgurUploader::replayable() {
+  switch( _source ) {
+    case SOURCE_FILE:
+    case SOURCE_TRANSFORM:
+    case SOURCE_FOLLOW:
     case SOURCE_BYTE_ARRAY:
+    case SOURCE_URL:
+    case SOURCE_FORM:
+    case SOURCE_SEGMENTS:
+    case SOURCE_MAPPED:     return true;
+    case SOURCE_GIF:
+    case SOURCE_VIDEO:      return _framePaths != NULL;
+    default:                return false;
+  }
+}
+
+
+// exponential backoff with jitter, picked in [backoff/2, backoff]
+bool ImgurUploader::retryDelay( uint32_t &wait ) {
+  uint32_t backoff = _retryPolicy.baseDelayMs;
+  for( uint8_t i=1; i<_status.attempts && backoff < _retryPolicy.maxDelayMs; i++ ) {
+    backoff *= 2;
+  }
+  if( backoff > _retryPolicy.maxDelayMs ) backoff = _retryPolicy.maxDelayMs;
+  wait = backoff/2 + random( backoff/2 + 1 );
+  if( _status.retryAfter > 0 ) {
+    uint32_t retryAfterMs = _status.retryAfter * 1000;
+    if( retryAfterMs > _retryPolicy.maxDelayMs ) return false;
+    if( retryAfterMs > wait ) wait = retryAfterMs;
+  }
+  return true;
+}
+
+
+bool ImgurUploader::sendImageData() {
+  _bodySent = 0;
+  switch( _source ) {
+    case SOURCE_STREAM:
+      return sendStream();
+    case SOURCE_BYTE_ARRAY:
+      if( _strip ) return sendStripped();
       log_d("Using memory");
-      packets = _arrayLen;
-      log_d("Byte array size: %d", packets );
-      size_t index = 0;
-      size_t packetSize = IMGUR_BUFFSIZE;
-      size_t total = 0;
-      while( packets > 0 ) {
-        // copy array chunk into buffer
-        for( size_t i=0; i<packetSize; i++ ) {
-          buf[i] = _byteArray[(index*IMGUR_BUFFSIZE)+i];
-        }
-        // send buffer
-        client.write( buf, packetSize );
-        log_v("Sent %d bytes", packetSize);
-        total+=packetSize;
-        _progress = (total*100) / _arrayLen;
-        if( _progressCB ) _progressCB( _progress );
-        if( packets > IMGUR_BUFFSIZE ) {
-          packets -= IMGUR_BUFFSIZE;
-          if( packets < IMGUR_BUFFSIZE ) {
-            packetSize = packets;
-          }
-          index++;
-        } else {
+      log_d("Byte array size: %d", _arrayLen );
+      // sent straight from the array, no copy needed
+      return writeBody( _byteArray, _arrayLen );
+    case SOURCE_FILE:
+      if( _strip ) return sendStripped();
+      log_d("Using filesystem");
+      return sendBuffered();
+    case SOURCE_READER:
+      log_d("Using stream reader");
+      return sendBuffered();
+    case SOURCE_RING:
+      log_d("Using ring buffer");
+      return sendBuffered();
+    case SOURCE_FOLLOW:
+      log_d("Following %s", _followPath);
+      return sendBuffered();
+    case SOURCE_URL:
+      log_d("Using URL %s", (const char*)_byteArray);
+      return writeBody( _byteArray, _arrayLen );
+    case SOURCE_SEGMENTS:
+      log_d("Using %d segments", _segmentCount);
+      return sendSegments();
+    case SOURCE_MAPPED:
+      log_d("Using partition %s", _partition->label);
+      return sendMapped();
+    case SOURCE_TRANSFORM:
+      log_d("Using filesystem, recompressed");
+      return sendTransformed();
+    case SOURCE_GIF:
+      log_d("Using %s frames, GIF encoded", _framePaths != NULL ? "file" : "callback");
+      return sendGif();
+    case SOURCE_VIDEO:
+      log_d("Using %s frames, AVI muxed", _framePaths != NULL ? "file" : "callback");
+      return sendVideo();
+    case SOURCE_FORM: // no image, sent by formAttempt()
+      break;
+  }
+  return false;
+}
+
+
+// lets the user callback push the image data through a write-combining BodyWriter
+bool ImgurUploader::sendStream() {
+  if( !_streamCB ) {
+    log_n("Stream method requested but no valid callback was defined!");
+    fail( PHASE_SOURCE, false );
+    return false;
+  }
+  uint8_t *buf = (uint8_t*)malloc( IMGUR_BUFFSIZE );
+  if( buf == NULL ) {
+    log_e("Can't alloc %d bytes, aborting", IMGUR_BUFFSIZE);
+    fail( PHASE_SOURCE, true );
+    return false;
+  }
+  BodyWriter writer( this, buf );
+  _streamCB( &writer );
+  writer.flush();
+  free(buf);
+  if( writer.failed ) {
+    if( _status.phase == PHASE_NONE ) fail( PHASE_SOURCE, false ); // overflow
+    return false;
+  }
+  if( !_chunked && writer.written != _arrayLen ) {
+    // a short body would leave the server waiting for the missing bytes
+    log_n("Stream callback wrote %d bytes instead of %d", writer.written, _arrayLen);
+    fail( PHASE_SOURCE, false );
+    return false;
+  }
+  return true;
+}
+
+
+// memory segments go through the BodyWriter, which only copies what's needed to fill a packet
+bool ImgurUploader::sendSegments() {
+  uint8_t *buf = (uint8_t*)malloc( IMGUR_BUFFSIZE * 2 );
+  if( buf == NULL ) {
+    log_e("Can't alloc %d bytes, aborting", IMGUR_BUFFSIZE * 2);
+    fail( PHASE_SOURCE, true );
+    return false;
+  }
+  uint8_t *readBuf = buf + IMGUR_BUFFSIZE;
+  BodyWriter writer( this, buf );
+  for( size_t i=0; i<_segmentCount && !writer.failed; i++ ) {
+    const Segment &segment = _segments[i];
+    if( segment.data ) {
+      writer.write( segment.data, segment.len );
+      continue;
+    }
+    if( segment.file == NULL || !segment.file->seek( segment.offset ) ) {
+      log_n("Segment #%d: file range not available", i);
+      fail( PHASE_SOURCE, false );
+      break;
+    }
+    size_t remaining = segment.len;
+    while( remaining > 0 && !writer.failed ) {
+      size_t packets = segment.file->read( readBuf, remaining < IMGUR_BUFFSIZE ? remaining : IMGUR_BUFFSIZE );
+      if( packets == 0 ) {
+        log_n("Segment #%d: file ended %d bytes early", i, remaining);
+        fail( PHASE_SOURCE, false );
+        break;
+      }
+      writer.write( readBuf, packets );
+      remaining -= packets;
+    }
+    if( remaining > 0 ) break;
+  }
+  if( _status.phase == PHASE_NONE ) writer.flush();
+  free(buf);
+  return _status.phase == PHASE_NONE && !writer.failed;
+}
+
+
+// maps one flash page at a time into the data address space and writes it straight to the socket
+bool ImgurUploader::sendMapped() {
+  size_t offset = _mapOffset;
+  size_t remaining = _arrayLen;
+  while( remaining > 0 ) {
+    size_t slice = IMGUR_MAP_SLICE - (offset % IMGUR_MAP_SLICE); // keeps the mapped window small
+    if( slice > remaining ) slice = remaining;
+    const void* ptr;
+    #if ESP_IDF_VERSION_MAJOR >= 5
+      esp_partition_mmap_handle_t handle;
+      esp_err_t err = esp_partition_mmap( _partition, offset, slice, ESP_PARTITION_MMAP_DATA, &ptr, &handle );
+    #else
+      spi_flash_mmap_handle_t handle;
+      esp_err_t err = esp_partition_mmap( _partition, offset, slice, SPI_FLASH_MMAP_DATA, &ptr, &handle );
+    #endif
+    if( err != ESP_OK ) {
+      log_e("Can't map %d bytes at 0x%x (error %d)", slice, offset, err);
+      fail( PHASE_SOURCE, true );
+      return false;
+    }
+    bool ok = writeBody( (const uint8_t*)ptr, slice );
+    #if ESP_IDF_VERSION_MAJOR >= 5
+      esp_partition_munmap( handle );
+    #else
+      spi_flash_munmap( handle );
+    #endif
+    if( !ok ) return false;
+    offset    += slice;
+    remaining -= slice;
+  }
+  return true;
+}
+
+
+// decode -> resize -> encode pipeline, working on strips of rows so memory stays bounded
+bool ImgurUploader::sendTransformed() {
+  uint8_t *buf = (uint8_t*)malloc( IMGUR_BUFFSIZE );
+  if( buf == NULL ) {
+    log_e("Can't alloc %d bytes, aborting", IMGUR_BUFFSIZE);
+    fail( PHASE_SOURCE, true );
+    return false;
+  }
+  uint16_t maxDim = _transformMaxDim;
+  uint8_t quality = _transformQuality > 0 ? _transformQuality : IMGUR_ADAPTIVE_QUALITY;
+  if( _transformBmp && _bmpQuality > 0 ) quality = _bmpQuality;
+  uint16_t width, height;
+  bool sized = _transformBmp ? imgurBmpSize( _sourceFile, width, height ) : imgurJpegSize( _sourceFile, width, height );
+  if( _deliveryBudget > 0 && _throughput > 0 && sized ) {
+    pickQuality( width, height, maxDim, quality );
+  }
+  BodyWriter writer( this, buf );
+  ImgurJpegEncoder encoder( quality, writer );
+  ImgurResizer resizer( maxDim, encoder );
+  bool ok = _transformBmp ? imgurDecodeBmp( _sourceFile, resizer ) : imgurDecodeJpeg( _sourceFile, maxDim, resizer );
+  writer.flush();
+  free(buf);
+  if( writer.failed ) return false;
+  if( !ok && !_transformBmp && writer.written == 0 && _sourceFile.seek( 0 ) ) {
+    // e.g. progressive JPEG, nothing was sent yet so the original can go instead,
+    // not a bitmap: the request already says image/jpeg
+    log_n("Can't recompress %s, sending it as is", _sourceFile.name());
+    return sendBuffered();
+  }
+  if( !ok ) {
+    fail( PHASE_SOURCE, false );
+    return false;
+  }
+  log_d("Recompressed %d bytes into %d", _sourceFile.size(), writer.written);
+  // learn how this kind of content compares to the typical size
+  float sample = writer.written / ( encoder.pixels() * jpegBitsPerPixel( quality ) / 8 );
+  _bppFactor = _bppFactor * 0.7f + sample * 0.3f;
+  return true;
+}
+
+
+// frames are decoded (or pushed by the callback) one after the other into the same GIF encoder,
+// only one row of each frame is in memory at a time
+bool ImgurUploader::sendGif() {
+  uint8_t *buf = (uint8_t*)malloc( IMGUR_BUFFSIZE );
+  if( buf == NULL ) {
+    log_e("Can't alloc %d bytes, aborting", IMGUR_BUFFSIZE);
+    fail( PHASE_SOURCE, true );
+    return false;
+  }
+  BodyWriter writer( this, buf );
+  ImgurGifEncoder encoder( writer, _gifDelay );
+  bool ok = true;
+  if( _framePaths != NULL ) {
+    ImgurResizer resizer( _gifMaxDim, encoder );
+    for( uint16_t i=0; ok && i<_frameCount; i++ ) {
+      File frame = _frameFS->open( _framePaths[i] );
+      if( !frame ) {
+        log_n("Could not open path %s", _framePaths[i] );
+        ok = false;
+        break;
+      }
+      bool bmp = strcmp( getMimeType( frame.name() ), "image/x-windows-bmp" ) == 0;
+      ok = bmp ? imgurDecodeBmp( frame, resizer ) : imgurDecodeJpeg( frame, _gifMaxDim, resizer );
+      if( !ok ) log_n("Could not decode frame %s", frame.name() );
+      frame.close();
+    }
+  } else if( _frameCB != NULL ) {
+    for( uint16_t i=0; !writer.failed && _frameCB( i, encoder ); i++ ) {
+      ;
+    }
+  }
+  ok = encoder.finish() && ok;
+  writer.flush();
+  free(buf);
+  if( writer.failed ) return false;
+  if( !ok ) {
+    fail( PHASE_SOURCE, false );
+    return false;
+  }
+  log_d("Encoded %d frames into %d bytes", encoder.frames(), writer.written);
+  return true;
+}
+
+
+// frames are wrapped into AVI chunks as they are read, the index only needs their sizes
+bool ImgurUploader::sendVideo() {
+  // writer buffer + file read buffer
+  uint8_t *buf = (uint8_t*)malloc( IMGUR_BUFFSIZE * 2 );
+  if( buf == NULL ) {
+    log_e("Can't alloc %d bytes, aborting", IMGUR_BUFFSIZE * 2);
+    fail( PHASE_SOURCE, true );
+    return false;
+  }
+  BodyWriter writer( this, buf );
+  ImgurAviMuxer muxer( writer );
+  bool ok = true;
+  uint16_t width = 0, height = 0;
+  if( _framePaths != NULL ) {
+    size_t framesSize = _arrayLen - ImgurAviMuxer::fileSize( 0 );
+    for( uint16_t i=0; ok && i<_frameCount; i++ ) {
+      File frame = _frameFS->open( _framePaths[i] );
+      if( !frame ) {
+        log_n("Could not open path %s", _framePaths[i] );
+        ok = false;
+        break;
+      }
+      size_t len = frame.size();
+      if( i == 0 ) {
+        imgurJpegSize( frame, width, height );
+        ok = muxer.begin( width, height, _videoFps, _frameCount, framesSize );
+      }
+      ok = ok && muxer.beginFrame( len );
+      while( ok && len > 0 ) {
+        size_t got = frame.read( buf + IMGUR_BUFFSIZE, len < IMGUR_BUFFSIZE ? len : IMGUR_BUFFSIZE );
+        if( got == 0 ) {
+          // frames can't change size once the headers are out
+          log_n("Frame %s is shorter than announced", frame.name() );
+          ok = false;
           break;
         }
+        ok = writer.write( buf + IMGUR_BUFFSIZE, got ) == got;
+        len -= got;
       }
-    break;
+      ok = ok && muxer.endFrame();
+      frame.close();
+    }
+  } else if( _jpegFrameCB != NULL ) {
+    const uint8_t* data;
+    size_t len;
+    for( uint16_t i=0; ok && _jpegFrameCB( i, data, len ); i++ ) {
+      if( i == 0 ) {
+        imgurJpegSize( data, len, width, height );
+        ok = muxer.begin( width, height, _videoFps );
+      }
+      ok = ok && muxer.beginFrame( len ) && writer.write( data, len ) == len && muxer.endFrame();
+    }
   }
+  ok = ok && muxer.end();
+  writer.flush();
   free(buf);
+  if( writer.failed ) return false;
+  if( !ok ) {
+    fail( PHASE_SOURCE, false );
+    return false;
+  }
+  log_d("Muxed %d frames (%dx%d) into %d bytes", muxer.frames(), width, height, writer.written);
+  return true;
+}
+
+
+// decodes a small version of the image to compare its signature with the last uploaded one
+bool ImgurUploader::unchanged( bool bmp ) {
+  bool decoded = bmp ? imgurDecodeBmp( _sourceFile, _signature ) : imgurDecodeJpeg( _sourceFile, IMGUR_SIGNATURE_DIM, _signature );
+  _sourceFile.seek( 0 );
+  if( !decoded || !_lastSignature.valid ) return false;
+  if( _maxSkipMs > 0 && millis() - _lastChangeMs > _maxSkipMs ) return false;
+  uint16_t changed = _signature.distance( _lastSignature, _changeCellDelta );
+  log_d("%d/%d areas changed since the last upload", changed, ImgurImageSignature::GRID * ImgurImageSignature::GRID);
+  return changed * 100 < _changePercent * ImgurImageSignature::GRID * ImgurImageSignature::GRID;
+}
+
+
+// measures the metadata-free size by filtering the headers only, everything after the first scan is kept
+bool ImgurUploader::prepareStrip() {
+  _sourceLen = _arrayLen;
+  ImgurJpegStripper counter( _stripKeep, NULL );
+  size_t consumed = 0;
+  if( _source == SOURCE_BYTE_ARRAY ) {
+    if( _arrayLen < 2 || _byteArray[0] != 0xFF || _byteArray[1] != 0xD8 ) return false;
+    while( consumed < _arrayLen && !counter.passthrough() ) {
+      size_t n = _arrayLen - consumed < IMGUR_BUFFSIZE ? _arrayLen - consumed : IMGUR_BUFFSIZE;
+      counter.write( _byteArray + consumed, n );
+      consumed += n;
+    }
+  } else {
+    uint8_t *buf = (uint8_t*)malloc( IMGUR_BUFFSIZE );
+    if( buf == NULL ) return false;
+    size_t n;
+    while( !counter.passthrough() && ( n = _sourceFile.read( buf, IMGUR_BUFFSIZE ) ) > 0 ) {
+      counter.write( buf, n );
+      consumed += n;
+    }
+    free( buf );
+    if( !_sourceFile.seek( 0 ) ) return false;
+  }
+  _arrayLen = counter.size() + ( _sourceLen - consumed );
+  log_d("Stripping metadata: %d bytes instead of %d", _arrayLen, _sourceLen);
+  return true;
+}
+
+
+// sends the JPEG through the metadata filter, Content-Length was measured by prepareStrip()
+bool ImgurUploader::sendStripped() {
+  uint8_t *buf = (uint8_t*)malloc( IMGUR_BUFFSIZE * 2 );
+  if( buf == NULL ) {
+    log_e("Can't alloc %d bytes, aborting", IMGUR_BUFFSIZE * 2);
+    fail( PHASE_SOURCE, true );
+    return false;
+  }
+  uint8_t *readBuf = buf + IMGUR_BUFFSIZE;
+  BodyWriter writer( this, buf );
+  ImgurJpegStripper stripper( _stripKeep, &writer );
+  if( _source == SOURCE_BYTE_ARRAY ) {
+    stripper.write( _byteArray, _sourceLen );
+  } else {
+    size_t remaining = _sourceLen;
+    while( remaining > 0 && !writer.failed ) {
+      size_t packets = _sourceFile.read( readBuf, remaining < IMGUR_BUFFSIZE ? remaining : IMGUR_BUFFSIZE );
+      if( packets == 0 ) break;
+      stripper.write( readBuf, packets );
+      remaining -= packets;
+    }
+  }
+  writer.flush();
+  free(buf);
+  if( writer.failed ) {
+    if( _status.phase == PHASE_NONE ) fail( PHASE_SOURCE, false );
+    return false;
+  }
+  if( writer.written != _arrayLen ) {
+    log_n("Source changed during upload (%d bytes instead of %d)", writer.written, _arrayLen);
+    fail( PHASE_SOURCE, false );
+    return false;
+  }
+  return true;
+}
+
+
+ImgurUploader::BodyWriter::BodyWriter( ImgurUploader* uploader, uint8_t* buf ) : written(0), failed(false), uploader(uploader), buf(buf), used(0) { ; }
+
+
+size_t ImgurUploader::BodyWriter::write( uint8_t c ) {
+  return write( &c, 1 );
+}
+
+
+size_t ImgurUploader::BodyWriter::write( const uint8_t* data, size_t len ) {
+  if( failed ) return 0;
+  if( !uploader->_chunked && written + len > uploader->_arrayLen ) {
+    log_n("Stream callback exceeds the declared %d bytes", uploader->_arrayLen);
+    failed = true;
+    return 0;
+  }
+  size_t accepted = len;
+  while( len > 0 ) {
+    if( used == 0 && len >= IMGUR_BUFFSIZE ) {
+      // large writes skip the copy
+      size_t packetSize = len - (len % IMGUR_BUFFSIZE);
+      if( !uploader->writeBody( data, packetSize ) ) {
+        failed = true;
+        return 0;
+      }
+      data += packetSize;
+      len  -= packetSize;
+      continue;
+    }
+    size_t chunk = IMGUR_BUFFSIZE - used;
+    if( chunk > len ) chunk = len;
+    memcpy( buf + used, data, chunk );
+    used += chunk;
+    data += chunk;
+    len  -= chunk;
+    if( used == IMGUR_BUFFSIZE ) flush();
+  }
+  written += accepted;
+  return failed ? 0 : accepted;
+}
+
+
+void ImgurUploader::BodyWriter::flush() {
+  if( used == 0 || failed ) return;
+  if( !uploader->writeBody( buf, used ) ) failed = true;
+  used = 0;
+}
+
+
+// pulls exactly _arrayLen bytes (or everything until the source finishes when chunked) through the transfer buffer
+bool ImgurUploader::sendBuffered() {
+  uint8_t *buf = (uint8_t*)malloc( IMGUR_BUFFSIZE );
+  if( buf == NULL ) {
+    log_e("Can't alloc %d bytes, aborting", IMGUR_BUFFSIZE);
+    fail( PHASE_SOURCE, true );
+    return false;
+  }
+  bool ok = true;
+  size_t remaining = _arrayLen;
+  uint32_t lastData = millis();
+  while( ok && ( _chunked || remaining > 0 ) ) {
+    size_t packets = readSource( buf, ( _chunked || remaining > IMGUR_BUFFSIZE ) ? IMGUR_BUFFSIZE : remaining );
+    if( packets == 0 ) {
+      if( _chunked && sourceFinished() ) break;
+      if( cancelled() ) {
+        fail( PHASE_CANCELLED, false );
+        ok = false;
+      } else if( millis() - lastData > _stallTimeout ) {
+        // the declared length can't be honored, the request has to be dropped
+        log_n("Source stalled with %d bytes left", remaining);
+        fail( PHASE_SOURCE, false );
+        ok = false;
+      } else if( !waitData( lastData ) ) {
+        fail( PHASE_CANCELLED, false );
+        ok = false;
+      }
+      continue;
+    }
+    lastData = millis();
+    ok = writeBody( buf, packets );
+    if( !_chunked ) remaining -= packets;
+  }
+  free(buf);
+  return ok;
+}
+
+
+// non blocking read, returns 0 when no data is available yet
+size_t ImgurUploader::readSource( uint8_t* buf, size_t maxLen ) {
+  switch( _source ) {
+    case SOURCE_FILE:
+    case SOURCE_TRANSFORM:
+      return _sourceFile.read( buf, maxLen );
+    case SOURCE_READER:
+      {
+        int avail = _reader->available();
+        if( avail <= 0 ) return 0;
+        return _reader->readBytes( buf, (size_t)avail < maxLen ? avail : maxLen );
+      }
+    case SOURCE_RING:
+      return _ring->pop( buf, maxLen );
+    case SOURCE_FOLLOW:
+      return readFollow( buf, maxLen );
+    default:
+      return 0;
+  }
+}
+
+
+// (re)opens the followed file at the current position, a fresh handle sees what was appended meanwhile
+bool ImgurUploader::reopenFollow() {
+  _sourceFile.close();
+  _sourceFile = _followFS->open( _followPath );
+  _followPolled = millis();
+  _followDrained = false;
+  return _sourceFile && _sourceFile.seek( _followPos );
+}
+
+
+size_t ImgurUploader::readFollow( uint8_t* buf, size_t maxLen ) {
+  size_t got = _sourceFile.read( buf, maxLen );
+  if( got == 0 && millis() - _followPolled >= IMGUR_FOLLOW_POLL ) {
+    // sampled before looking, so the writes that preceded endFollow() are seen
+    bool ended = _followEnded;
+    if( !reopenFollow() ) return 0;
+    got = _sourceFile.read( buf, maxLen );
+    _followDrained = got == 0 && ended;
+  }
+  _followPos += got;
+  return got;
+}
+
+
+// only meaningful for chunked uploads: the source has no more data to give
+bool ImgurUploader::sourceFinished() {
+  switch( _source ) {
+    case SOURCE_RING:   return _ring->finished();
+    case SOURCE_FOLLOW: return _followDrained;
+    default:          return true;
+  }
+}
+
+
+bool ImgurUploader::writeBody( const uint8_t* data, size_t len ) {
+  while( len > 0 ) {
+    size_t packetSize = len < IMGUR_BUFFSIZE ? len : IMGUR_BUFFSIZE;
+    if( !throttle( packetSize ) ) {
+      log_n("Upload cancelled after %d bytes", _bodySent );
+      fail( PHASE_CANCELLED, false );
+      return false;
+    }
+    if( !writePacket( data, packetSize ) ) {
+      log_n("Connection lost after %d bytes", _bodySent );
+      fail( PHASE_SEND, true );
+      return false;
+    }
+    log_v("Sent %d bytes", packetSize);
+    data      += packetSize;
+    len       -= packetSize;
+    _bodySent += packetSize;
+    if( cancelled() || ( _chunkCB && !_chunkCB( _chunkArg ) ) ) {
+      log_n("Upload cancelled after %d bytes", _bodySent );
+      fail( PHASE_CANCELLED, false );
+      return false;
+    }
+    if( _chunked ) continue; // no progress without a known length
+    byte progress = _arrayLen ? (_bodySent*100) / _arrayLen : 100;
+    if( _progressCB ) _progressCB( progress );
+    else defaultProgressCallback( progress );
+  }
+  return true;
+}
+
+
+// delay() that runs the chunk callback meanwhile and gives up early when the upload gets cancelled
+bool ImgurUploader::pause( uint32_t ms ) {
+  uint32_t start = millis();
+  while( !cancelled() ) {
+    if( _chunkCB && !_chunkCB( _chunkArg ) ) {
+      cancel();
+      return false;
+    }
+    uint32_t elapsed = millis() - start;
+    if( elapsed >= ms ) return true;
+    delay( ms - elapsed < 20 ? ms - elapsed : 20 );
+  }
+  return false;
+}
+
+
+// token bucket: waits until len bytes worth of credit accumulated, delay() lets the other tasks use the radio meanwhile,
+// false when the upload got cancelled during the wait
+bool ImgurUploader::throttle( size_t len ) {
+  uint32_t rate = _rateLimit;
+  uint32_t now = millis();
+  if( rate == 0 ) {
+    _rateRefillMs = now;
+    _rateTokens = _rateBurst;
+    return true;
+  }
+  // a packet is sent whole, the bucket holds at least one
+  uint32_t capacity = _rateBurst > len ? _rateBurst : len;
+  uint32_t elapsed = now - _rateRefillMs;
+  uint64_t tokens = _rateTokens + (uint64_t)rate * elapsed / 1000;
+  _rateTokens = tokens > capacity ? capacity : tokens;
+  _rateRefillMs = now;
+  if( _rateTokens < len ) {
+    uint32_t wait = ( (uint64_t)( len - _rateTokens ) * 1000 + rate - 1 ) / rate;
+    bool waited = pause( wait );
+    _status.throttledMs += wait;
+    _rateTokens = len;
+    _rateRefillMs = millis();
+    if( !waited ) return false;
+  }
+  _rateTokens -= len;
+  return true;
+}
+
+
+// one TLS record per packet, framed as a single HTTP chunk when chunked
+bool ImgurUploader::writePacket( const uint8_t* data, size_t len ) {
+  if( !_chunked ) {
+    return client.write( data, len ) == len;
+  }
+  int headLen = sprintf( (char*)_chunkBuf, "%x\r\n", len );
+  memcpy( _chunkBuf + headLen, data, len );
+  memcpy( _chunkBuf + headLen + len, "\r\n", 2 );
+  size_t packetLen = headLen + len + 2;
+  return client.write( _chunkBuf, packetLen ) == packetLen;
+}
+
+
+// nothing to read yet from the source or the server: runs the chunk callback meanwhile, the time it takes
+// (e.g. a preempting upload) doesn't count against the deadline, false when it cancels the upload
+bool ImgurUploader::waitData( uint32_t &deadline ) {
+  if( _chunkCB ) {
+    uint32_t start = millis();
+    if( !_chunkCB( _chunkArg ) ) {
+      cancel();
+      return false;
+    }
+    deadline += millis() - start;
+  }
+  delay(1);
+  return true;
+}
+
+
+bool ImgurUploader::readLine( char* line, size_t maxLen, uint32_t &deadline ) {
+  size_t len = 0;
+  while( (int32_t)(deadline - millis()) > 0 && !cancelled() ) {
+    if( !client.available() ) {
+      if( !client.connected() || !waitData( deadline ) ) break;
+      continue;
+    }
+    char c = client.read();
+    if( c == '\n' ) {
+      if( len > 0 && line[len-1] == '\r' ) len--;
+      line[len] = '\0';
+      return true;
+    }
+    if( len < maxLen-1 ) line[len++] = c;
+  }
+  line[len] = '\0';
+  return false;
+}
+
+
+// reads count bytes (or until the server closes if count is SIZE_MAX), keeps what fits in body
+bool ImgurUploader::readBody( char* body, size_t &bodyLen, size_t count, uint32_t &deadline ) {
+  while( count > 0 && (int32_t)(deadline - millis()) > 0 && !cancelled() ) {
+    if( !client.available() ) {
+      if( !client.connected() || !waitData( deadline ) ) break;
+      continue;
+    }
+    int c = client.read();
+    if( c < 0 ) continue;
+    if( bodyLen < IMGUR_RESPONSE_MAXLEN ) body[bodyLen++] = c;
+    if( count != SIZE_MAX ) count--;
+  }
+  body[bodyLen] = '\0';
+  return count == 0 || ( count == SIZE_MAX && !client.connected() );
+}
+
+
+// returns a pointer to the header value if line is the "name:" header
+static const char* headerValue( const char* line, const char* name ) {
+  size_t nameLen = strlen( name );
+  if( strncasecmp( line, name, nameLen ) != 0 || line[nameLen] != ':' ) return NULL;
+  line += nameLen + 1;
+  while( *line == ' ' ) line++;
+  return line;
 }
 
 
 int ImgurUploader::readResponse(void) {
-  int ret = -1;
-  while (client.connected()) {
-    if(client.available()) {
-      String response = client.readStringUntil('\n');
-      log_v("%s", response.c_str());
-      DynamicJsonDocument jsonImgurBuffer( 8192 );
-      DeserializationError error = deserializeJson(jsonImgurBuffer, response );
-      if (!error) {
-        JsonObject root = jsonImgurBuffer.as<JsonObject>();
-        if( root["success"].as<String>() == "true" ) {
-          String link = root["data"]["link"].as<String>();
-          String id = root["data"]["id"].as<String>();
-          sprintf( URL, IMGUR_URL_MASK, id.c_str() );
-          Serial.printf("Link: %s, id: %s\n", link.c_str(), id.c_str() );
-          ret = 1;
-        } else {
-          // upload failed
-          log_n("Upload failed (JSON response is bigger than the buffer or data got corrupted?)");
-          log_e("Response: %s", response.c_str() );           //Print request answer
-        }
+  uint32_t deadline = millis() + IMGUR_RESPONSE_TIMEOUT;
+  char line[128];
+  // status line, e.g. "HTTP/1.1 200 OK"
+  if( !readLine( line, sizeof(line), deadline ) || sscanf( line, "HTTP/%*d.%*d %d", &_status.httpCode ) != 1 ) {
+    log_n("No response from server");
+    client.stop();
+    return fail( PHASE_RESPONSE, true );
+  }
+  size_t contentLength = SIZE_MAX;
+  bool chunked = false;
+  bool keepAlive = true;
+  int32_t clientRemaining = -1, postRemaining = -1;
+  uint32_t postReset = 0;
+  const char* value;
+  while( true ) {
+    if( !readLine( line, sizeof(line), deadline ) ) {
+      log_n("Truncated response headers");
+      client.stop();
+      return fail( PHASE_RESPONSE, true );
+    }
+    if( line[0] == '\0' ) break; // end of headers
+    log_v("%s", line);
+    if( (value = headerValue( line, "Content-Length" )) ) {
+      contentLength = strtoul( value, NULL, 10 );
+    } else if( (value = headerValue( line, "Transfer-Encoding" )) ) {
+      chunked = strncasecmp( value, "chunked", 7 ) == 0;
+    } else if( (value = headerValue( line, "Connection" )) ) {
+      keepAlive = strncasecmp( value, "close", 5 ) != 0;
+    } else if( (value = headerValue( line, "Retry-After" )) ) {
+      _status.retryAfter = strtoul( value, NULL, 10 );
+    } else if( (value = headerValue( line, "X-RateLimit-ClientRemaining" )) ) {
+      clientRemaining = strtol( value, NULL, 10 );
+    } else if( (value = headerValue( line, "X-Post-Rate-Limit-Remaining" )) ) {
+      postRemaining = strtol( value, NULL, 10 );
+    } else if( (value = headerValue( line, "X-Post-Rate-Limit-Reset" )) ) {
+      postReset = strtoul( value, NULL, 10 );
+    }
+  }
+  updateKey( clientRemaining, postRemaining, postReset );
+
+  char* body = (char*)malloc( IMGUR_RESPONSE_MAXLEN+1 );
+  if( body == NULL ) {
+    log_e("Can't alloc %d bytes, aborting", IMGUR_RESPONSE_MAXLEN+1);
+    client.stop();
+    return fail( PHASE_RESPONSE, true );
+  }
+  size_t bodyLen = 0;
+  bool complete = false;
+  if( chunked ) {
+    while( readLine( line, sizeof(line), deadline ) ) {
+      size_t chunkLen = strtoul( line, NULL, 16 );
+      if( chunkLen == 0 ) {
+        complete = readLine( line, sizeof(line), deadline ); // last CRLF
+        break;
       }
+      if( !readBody( body, bodyLen, chunkLen, deadline ) || !readLine( line, sizeof(line), deadline ) ) break;
     }
+  } else {
+    complete = readBody( body, bodyLen, contentLength, deadline );
+    if( contentLength == SIZE_MAX ) keepAlive = false; // body delimited by connection close
+  }
+  log_v("%s", body);
+  if( !complete || !keepAlive ) {
+    client.stop();
+    log_d("connection closed");
+  } else {
+    _idleSince = millis();
   }
+
+  int ret;
+  if( !complete ) {
+    log_n("Incomplete response (HTTP %d)", _status.httpCode);
+    ret = fail( PHASE_RESPONSE, true );
+  } else {
+    ret = parseResponse( body, bodyLen );
+  }
+  free( body );
   return ret;
 }
 
+
+int ImgurUploader::parseResponse( const char* body, size_t len ) {
+  if( _tokenReply ) return parseToken( body, len );
+  StaticJsonDocument<128> filter;
+  filter["success"]       = true;
+  filter["data"]["id"]    = true;
+  filter["data"]["link"]  = true;
+  filter["data"]["deletehash"] = true;
+  filter["data"]["error"] = true;
+  DynamicJsonDocument jsonImgurBuffer( 1024 );
+  DeserializationError error = deserializeJson( jsonImgurBuffer, body, len, DeserializationOption::Filter( filter ) );
+
+  int code = _status.httpCode;
+  bool http2xx = code >= 200 && code < 300;
+  if( !error ) {
+    JsonVariant apiError = jsonImgurBuffer["data"]["error"];
+    if( apiError.is<JsonObject>() ) {
+      // e.g. {"code":1003,"message":"File type invalid (1)","type":"ImgurException"}
+      _status.apiCode = apiError["code"] | 0;
+      strlcpy( _status.error, apiError["message"] | "", sizeof(_status.error) );
+    } else {
+      strlcpy( _status.error, apiError | "", sizeof(_status.error) );
+    }
+  }
+  if( !http2xx ) {
+    log_n("Upload failed with HTTP %d: %s", code, _status.error );
+    return fail( PHASE_HTTP, code == 408 || code == 429 || code >= 500 );
+  }
+  if( error ) {
+    log_n("Upload failed (JSON response is bigger than the buffer or data got corrupted?)");
+    log_e("Response: %s", body );
+    return fail( PHASE_RESPONSE, true );
+  }
+  if( !jsonImgurBuffer["success"].as<bool>() ) {
+    log_n("Upload rejected: %s", _status.error );
+    return fail( PHASE_API, false );
+  }
+  const char* id = jsonImgurBuffer["data"]["id"] | "";
+  if( id[0] != '\0' ) {
+    // update/delete calls reply with "data":true, the last image stays current
+    _result.ret = 1;
+    strlcpy( _result.id, id, sizeof(_result.id) );
+    strlcpy( _result.deleteHash, jsonImgurBuffer["data"]["deletehash"] | "", sizeof(_result.deleteHash) );
+  }
+  if( _source != SOURCE_FORM ) {
+    const char* link = jsonImgurBuffer["data"]["link"] | "";
+    snprintf( URL, sizeof(URL), IMGUR_URL_MASK, id );
+    Serial.printf("Link: %s, id: %s\n", link, id );
+  }
+  _status.phase = PHASE_DONE;
+  return 1;
+}
+
 const char* ImgurUploader::getMimeType( const char* _fileName ) {
   String fileName =  _fileName;
   if( fileName.endsWith(".jpg") || fileName.endsWith(".jpeg") ) {
@@ -37,6 +37,14 @@
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 #include <FS.h>
+#include <esp_partition.h>
+#include <atomic>
+#include "ImgurRingBuffer.h"
+#include "ImgurImage.h"
+#include "ImgurGifEncoder.h"
+#include "ImgurAviMuxer.h"
+
+#define IMGUR_MAX_KEYS 8 // client IDs in a key ring
 
 
 class ImgurUploader {
@@ -45,47 +53,386 @@ class ImgurUploader {
     enum SourceType {
       SOURCE_FILE,
       SOURCE_BYTE_ARRAY,
-      SOURCE_STREAM
+      SOURCE_STREAM,
+      SOURCE_READER,
+      SOURCE_RING,
+      SOURCE_SEGMENTS,
+      SOURCE_MAPPED,
+      SOURCE_TRANSFORM,
+      SOURCE_GIF,
+      SOURCE_VIDEO,
+      SOURCE_URL,
+      SOURCE_FORM,    // API call with a small url-encoded form, no image
+      SOURCE_FOLLOW
+    };
+
+    // one piece of a scatter-gather upload: either memory (RAM or flash) or a range of an open file
+    struct Segment {
+      const uint8_t* data;   // NULL when reading from file
+      size_t         len;
+      fs::File*      file;   // caller keeps it open during the upload
+      size_t         offset; // file offset of the range
+    };
+
+    // where an upload attempt stopped, upload*() return -phase on failure
+    enum UploadPhase {
+      PHASE_NONE = 0,
+      PHASE_WIFI,     // WiFi not connected
+      PHASE_DNS,      // api.imgur.com could not be resolved
+      PHASE_CONNECT,  // TCP connection or TLS handshake failed
+      PHASE_SEND,     // connection dropped while sending the request
+      PHASE_RESPONSE, // no (or malformed) response before timeout
+      PHASE_HTTP,     // server replied with a non-2xx status code
+      PHASE_API,      // imgur replied but reported success=false
+      PHASE_SOURCE,   // image source could not be read
+      PHASE_DONE,     // upload succeeded
+      PHASE_SKIPPED,  // nothing sent, the image looks like the last one (upload*() return 0)
+      PHASE_CANCELLED, // stopped on request before completion
+      PHASE_REPLACED  // queued job dropped for a newer one with the same coalescing key, never started
+    };
+
+    struct UploadStatus {
+      UploadPhase phase;
+      int         httpCode;   // HTTP status code, 0 if no response was read
+      int         apiCode;    // imgur error code when provided (e.g. 1003)
+      char        error[64];  // imgur error message, if any
+      bool        retriable;  // transient failure, worth trying again
+      uint8_t     attempts;   // attempts spent on the last upload
+      uint32_t    retryAfter; // Retry-After header value (seconds), 0 if absent
+      uint32_t    elapsedMs;  // duration of the last attempt, connection to response
+      uint32_t    sendMs;     // time spent sending the image data
+      size_t      bodySize;   // image bytes sent by the last attempt
+      uint8_t     keyIndex;   // client ID used by the last attempt
+      uint32_t    throttledMs; // time the bandwidth limit held the upload back
     };
+
+    struct RetryPolicy {
+      uint8_t  maxAttempts; // attempts per upload, including the first one (1 = never retry)
+      uint32_t baseDelayMs; // backoff before the first retry, doubled on each retry
+      uint32_t maxDelayMs;  // backoff ceiling, also caps honored Retry-After values
+      uint16_t budget;      // global retry tokens: each retry spends one, each success earns one back
+    };
+
+    // per-image outcome of a batch upload
+    struct UploadResult {
+      int  ret;            // what uploadFile() returned for this image
+      char id[16];         // imgur id, the image is at https://imgur.com/<id>
+      char deleteHash[32]; // allows editing or deleting the anonymous image later
+    };
+
     // get a **client ID** at https://apidocs.imgur.com/?version=latest#authorization-and-oauth
     ImgurUploader(const char *appKey);
 
+    // key ring: uploads go to the client ID with the most remaining quota, rate limited IDs cool down until their reset,
+    // up to IMGUR_MAX_KEYS, the strings must stay valid
+    ImgurUploader( const char* const* appKeys, uint8_t count );
+
     // upload from filesystem
     int   uploadFile( fs::FS &fs, const char* path );
 
     // upload from a bytes _array
     int   uploadBytes( const uint8_t* byteArray, size_t arrayLen, const char* imageName="pic.jpg", const char* imageMimeType="image/jpeg" );
 
+    // create an anonymous album and upload the files into it over the same connection, results (optional) gets one entry per file,
+    // returns the number of uploaded images, or -phase when the album could not be created
+    int   uploadAlbum( fs::FS &fs, const char* const* paths, uint16_t count, UploadResult* results=NULL, const char* title=NULL );
+
+    // change the title and/or description (NULL = unchanged) of an anonymous image, no image data is sent
+    int   updateImage( const char* deleteHash, const char* title, const char* description=NULL );
+
+    // delete an anonymous image
+    int   deleteImage( const char* deleteHash );
+
+    // upload the files of a directory accepted by filter (NULL = images), skipping those already listed in the
+    // manifest file of the directory, each upload appends "hash link deletehash path" to the manifest,
+    // returns the number of uploaded files, or -phase when none could be uploaded because of a failure
+    int   uploadDirectory( fs::FS &fs, const char* path, bool (*filter)( const char* path )=NULL );
+
+    // let imgur fetch the image from an http(s) URL, only the URL is sent
+    int   uploadURL( const char* imageURL );
+
+    // upload a file while it is still being written (chunked), new data is sent as it appears until
+    // the producer calls endFollow() and everything written was sent, setStallTimeout() bounds gaps between writes
+    int   uploadFollow( fs::FS &fs, const char* path, const char* imageName=NULL, const char* imageMimeType=NULL );
+
+    // the file given to uploadFollow() is complete, can be called from any task (also before the upload starts)
+    void  endFollow() { _followEnded = true; }
+
     // upload from a stream source
     int   uploadStream( size_t arrayLen, void (*streamCB)( Stream* client ), const char* imageName="pic.jpg", const char* imageMimeType="image/jpeg" );
 
+    // upload len bytes pulled from any Stream (Serial camera, HTTP download, UART)
+    int   uploadFrom( Stream &src, size_t len, const char* imageName="pic.jpg", const char* imageMimeType="image/jpeg" );
+
+    // upload what a producer pushes into the ring, len=0 for unknown length (chunked transfer encoding)
+    int   uploadRing( ImgurRingBuffer &ring, size_t len=0, const char* imageName="pic.jpg", const char* imageMimeType="image/jpeg" );
+
+    // upload several non-contiguous segments as a single image, without concatenating them
+    int   uploadSegments( const Segment* segments, size_t count, const char* imageName="pic.jpg", const char* imageMimeType="image/jpeg" );
+
+    // upload len bytes stored at offset in a raw flash data partition, mapped and sent without copy
+    int   uploadMapped( const char* partitionLabel, size_t offset, size_t len, const char* imageName="pic.jpg", const char* imageMimeType="image/jpeg" );
+
+    // upload JPEG/BMP frame files as one animated GIF, frames are downscaled to fit maxDimension (0 = keep size)
+    int   uploadGif( fs::FS &fs, const char* const* paths, uint16_t count, uint16_t frameDelayMs, uint16_t maxDimension=240, const char* imageName="burst.gif" );
+
+    // upload the frames pushed by the callback as one animated GIF: each call writes frame number frame
+    // into sink (beginImage(), one writeRow() per RGB888 row, endImage()) and returns false when there are no more
+    int   uploadGif( bool (*frameCB)( uint16_t frame, ImgurRowSink &sink ), uint16_t frameDelayMs, const char* imageName="burst.gif" );
+
+    // upload JPEG frame files (e.g. a time-lapse) as one MJPEG AVI video played at fps
+    int   uploadVideo( fs::FS &fs, const char* const* paths, uint16_t count, uint8_t fps, const char* videoName="timelapse.avi" );
+
+    // upload the JPEG frames handed by the callback as one MJPEG AVI video: each call points data/len to
+    // frame number frame (kept valid until the next call) and returns false when there are no more
+    int   uploadVideo( bool (*frameCB)( uint16_t frame, const uint8_t* &data, size_t &len ), uint8_t fps, const char* videoName="timelapse.avi" );
+
+    // upload to a user account with OAuth bearer tokens obtained from refreshToken, the access token
+    // (and rotated refresh token) is cached in cacheFS so a reboot doesn't force a refresh, strings must stay valid
+    void  setOAuth( const char* clientId, const char* clientSecret, const char* refreshToken, fs::FS* cacheFS=NULL, const char* cachePath="/imgur_token.json" );
+
+    // call when idle (e.g. from loop() or a timer task): refreshes the access token ahead of its expiry so uploads never
+    // wait for it, this is the only proactive refresh, an upload only refreshes a token that is already missing or expired,
+    // returns false if a refresh was needed and failed
+    bool  maintainToken( bool force=false );
+
+    // downscale JPEG and BMP files given to uploadFile() to fit maxDimension and re-encode them as JPEG at quality (1-100),
+    // 0 to disable, bitmaps the decoder can't read (RLE, less than 8 bits) are sent as they are
+    void  setTransform( uint16_t maxDimension, uint8_t quality=80 );
+
+    // send BMP files given to uploadFile() as JPEG encoded at quality (1-100), 0 to disable,
+    // bitmaps the decoder can't read (RLE, less than 8 bits) are sent as they are
+    void  setBmpTranscode( uint8_t quality=85 );
+
+    // drop EXIF/XMP/thumbnails/comments from JPEG files and byte arrays before sending them,
+    // keep is a mask of ImgurJpegStripper::KEEP_ICC and ImgurJpegStripper::KEEP_ORIENTATION
+    void  setStripMetadata( bool strip, uint8_t keep=0 );
+
+    // skip uploadFile() when a JPEG/BMP changed in less than minChangedPercent of its area since the last upload,
+    // areas count as changed when their average brightness moved by more than cellDelta (0-255),
+    // an upload is forced after maxSkipSeconds (0 = never), minChangedPercent=0 to disable
+    void  setChangeDetection( uint8_t minChangedPercent, uint8_t cellDelta=12, uint32_t maxSkipSeconds=0 );
+
+    // pick the JPEG resolution/quality of uploadFile() so the upload fits within seconds, 0 to disable
+    void  setDeliveryBudget( uint16_t seconds ) { _deliveryBudget = seconds * 1000; }
+
+    // moving estimate of the uplink throughput in bytes/s, 0 until measured
+    uint32_t getThroughput(void) { return _throughput; }
+
+    // cap the upload rate to bytesPerSec (0 = unlimited) with bursts up to burstBytes, so other
+    // traffic on the radio keeps a low latency, can be changed while an upload is running
+    void  setBandwidthLimit( uint32_t bytesPerSec, uint32_t burstBytes=8192 );
+
+    // give up when a File/Stream source delivers no data for this long (default 5s)
+    void  setStallTimeout( uint32_t ms ) { _stallTimeout = ms; }
+
+    // called between two packets of the image data and while the upload waits (bandwidth limit, reply,
+    // retry backoff), e.g. to run something more urgent meanwhile, returning false cancels the upload,
+    // it isn't called during the connection and TLS handshake
+    void  setChunkCallback( bool (*chunkCB)( void* arg ), void* arg ) { _chunkCB = chunkCB; _chunkArg = arg; }
+
     // replace the default progress callback by a custom callback
     void  setProgressCallback( void (*progressCB)( byte progress ) );
 
+    // replace the default retry policy (3 attempts, 500ms..8s backoff, 10 tokens budget)
+    void  setRetryPolicy( const RetryPolicy &policy );
+
+    // stop the running upload at the next packet (or while it waits for the reply or a retry), it then
+    // returns -PHASE_CANCELLED, can be called from any task or an ISR, does nothing when idle
+    void  cancel() { cancel( _uploadId ); }
+
+    // same, only for the given upload: a late cancel of an upload that's over never hits the next one
+    void  cancel( uint32_t uploadId ) { if( uploadId != 0 ) _cancelId = uploadId; }
+
+    // id of the running upload, 0 when idle
+    uint32_t getUploadId(void) { return _uploadId; }
+
+    // id the next upload will run under, so it can be cancelled before it starts, the reservation
+    // ends with that upload call, even when it fails or is skipped before sending anything
+    uint32_t reserveUploadId();
+
+    // close the kept-alive connection to api.imgur.com
+    void  end();
+
     // retrieve the last successfully submitted URL
     char* getURL(void) { return URL; }
 
+    // id and deletehash of the last successfully submitted image
+    const UploadResult& getResult(void) { return _result; }
+    const char* getDeleteHash(void) { return _result.deleteHash; }
+
+    // link and deletehash of the last album created by uploadAlbum()
+    const char* getAlbumURL(void) { return _albumURL; }
+    const char* getAlbumDeleteHash(void) { return _albumDeleteHash; }
+
+    // details about the last upload (phase, HTTP code, imgur error)
+    const UploadStatus& getStatus(void) { return _status; }
+
   private:
 
-    void             sendImageData();
+    // handed to the uploadStream() callback, coalesces small writes into full size TLS records
+    class BodyWriter : public Stream {
+      public:
+        BodyWriter( ImgurUploader* uploader, uint8_t* buf );
+        size_t write( uint8_t c );
+        size_t write( const uint8_t* data, size_t len );
+        using  Print::write;
+        void   flush();
+        int    available() { return 0; }
+        int    read() { return -1; }
+        int    peek() { return -1; }
+        size_t written; // bytes accepted from the callback
+        bool   failed;
+      private:
+        ImgurUploader* uploader;
+        uint8_t*       buf;
+        size_t         used;
+    };
+
+    bool             sendImageData();
+    bool             sendStream( void );
+    bool             sendSegments( void );
+    bool             sendMapped( void );
+    bool             sendTransformed( void );
+    bool             sendGif( void );
+    bool             sendVideo( void );
+    bool             sendStripped( void );
+    bool             prepareStrip( void );
+    bool             unchanged( bool bmp );
+    void             pickQuality( uint16_t width, uint16_t height, uint16_t &maxDim, uint8_t &quality );
+    void             measureThroughput( void );
+    bool             sendBuffered( void );
+    size_t           readSource( uint8_t* buf, size_t maxLen );
+    bool             sourceFinished( void );
+    size_t           readFollow( uint8_t* buf, size_t maxLen );
+    bool             reopenFollow( void );
+    bool             writeBody( const uint8_t* data, size_t len );
+    bool             writePacket( const uint8_t* data, size_t len );
+    bool             throttle( size_t len );
+    bool             pause( uint32_t ms );
+    bool             waitData( uint32_t &deadline );
+    bool             cancelled( void ) { return _uploadId != 0 && _cancelId == _uploadId; }
     void             (*_progressCB)( byte progress ); // progress callback pointer
     void             (*_streamCB)( Stream* client ); // stream write callback pointer
+    bool             (*_chunkCB)( void* arg );
+    void*            _chunkArg;
 
     int              upload( const char* imageName, const char* imageMimeType );
+    int              uploadAttempt( const char* imageName, const char* imageMimeType );
+    int              formAttempt( void );
+    int              formRequest( const char* method, const char* path, const char* form );
+    void             resetAttempt( void );
+    bool             pickKey( void );
+    bool             refreshAccessToken( void );
+    int              parseToken( const char* body, size_t len );
+    void             saveToken( void );
+    bool             tokenDue( void );
+    const char*      authorization( char* buf, size_t len );
+    void             updateKey( int32_t clientRemaining, int32_t postRemaining, uint32_t resetSeconds );
+    bool             connect( void );
+    int              fail( UploadPhase phase, bool retriable );
+    bool             rewindSource( void );
+    bool             replayable( void );
+    bool             retryDelay( uint32_t &wait );
+    bool             readLine( char* line, size_t maxLen, uint32_t &deadline );
+    bool             readBody( char* body, size_t &bodyLen, size_t count, uint32_t &deadline );
     int              readResponse( void );
+    int              parseResponse( const char* body, size_t len );
 
     const char*      getMimeType( const char* fileName );
+    uint64_t*        loadManifest( fs::FS &fs, const char* manifestPath, size_t &count );
 
-    const char*      appKey;
+    // quota of a client ID as reported by the X-RateLimit-* and X-Post-Rate-Limit-* headers
+    struct KeyState {
+      const char* id;
+      int32_t     clientRemaining; // daily application credits, -1 until known
+      int32_t     postRemaining;   // hourly upload credits, -1 until known
+      uint32_t    coolUntil;       // millis() when an exhausted key may be tried again, 0 if usable
+    };
+
+    const char*      appKey;    // client ID of the current attempt
+    const char*      _oauthClientId;   // NULL for anonymous uploads
+    const char*      _oauthSecret;
+    char             _accessToken[64];
+    char             _refreshToken[64];
+    uint32_t         _tokenExpiry;     // uptime seconds, 0 when unknown
+    fs::FS*          _tokenFS;
+    const char*      _tokenPath;
+    bool             _tokenReply;      // the response being read is from oauth2/token
+    KeyState         _keys[IMGUR_MAX_KEYS];
+    uint8_t          _keyCount;
+    uint8_t          _keyIndex;
     char             URL[40]; // http://i.imgur.com/xxxxx.jpg
+    UploadResult     _result;          // id/deletehash of the last created image (or album)
+    char             _albumURL[40];
+    char             _albumId[16];
+    char             _albumDeleteHash[32];
+    const char*      _album;           // album images go to (deletehash, or id with OAuth), NULL for none
+    const char*      _method;          // SOURCE_FORM request
+    const char*      _apiPath;
     uint8_t*         _byteArray;
     size_t           _arrayLen;
+    size_t           _bodySent; // image bytes written by the current attempt
+    bool             _chunked;  // image length unknown, use chunked transfer encoding
+    uint32_t         _idleSince; // when the kept-alive connection finished its last reply
+    uint8_t*         _chunkBuf; // packet + chunk framing, allocated for chunked uploads
 
     WiFiClientSecure client;
 
     File             _sourceFile;
+    Stream*          _reader;
+    ImgurRingBuffer* _ring;
+    const Segment*   _segments;
+    size_t           _segmentCount;
+    const esp_partition_t* _partition;
+    size_t           _mapOffset;
+    uint16_t         _transformMaxDim;
+    uint8_t          _transformQuality;
+    bool             _transformBmp;   // SOURCE_TRANSFORM reads a BMP instead of a JPEG
+    fs::FS*          _frameFS;
+    const char* const* _framePaths;   // NULL when frames come from a callback
+    uint16_t         _frameCount;
+    uint16_t         _gifDelay;       // ms between frames
+    uint16_t         _gifMaxDim;
+    bool             (*_frameCB)( uint16_t frame, ImgurRowSink &sink );
+    bool             (*_jpegFrameCB)( uint16_t frame, const uint8_t* &data, size_t &len );
+    uint8_t          _videoFps;
+    uint8_t          _bmpQuality;
+    bool             _stripMetadata;
+    uint8_t          _stripKeep;
+    bool             _strip;          // strip this upload, _sourceLen is the unfiltered size
+    size_t           _sourceLen;
+    uint8_t          _changePercent;
+    uint8_t          _changeCellDelta;
+    uint32_t         _maxSkipMs;
+    uint32_t         _lastChangeMs;     // when the last signature was uploaded
+    ImgurImageSignature _lastSignature; // last uploaded image
+    ImgurImageSignature _signature;     // image being uploaded
+    uint32_t         _deliveryBudget; // ms
+    uint32_t         _throughput;     // bytes/s
+    uint32_t         _overheadMs;     // connection + response time of an upload
+    float            _bppFactor;      // measured / predicted JPEG size
+    uint32_t         _stallTimeout;
+    std::atomic<uint32_t> _uploadId;   // running upload, 0 when idle
+    std::atomic<uint32_t> _reservedId; // taken by the next upload, 0 for a new id
+    std::atomic<uint32_t> _cancelId;   // upload to stop
+    std::atomic<uint32_t> _lastId;
+    std::atomic<bool> _followEnded;   // cleared when a follow upload ends
+    bool             _followDrained;  // nothing left after the end of the file was signaled
+    fs::FS*          _followFS;
+    const char*      _followPath;
+    size_t           _followPos;
+    uint32_t         _followPolled;   // last time the file was reopened to look for new data
+    volatile uint32_t _rateLimit;     // bytes/s, 0 when unlimited
+    volatile uint32_t _rateBurst;
+    uint32_t         _rateTokens;     // bytes that can be sent right away
+    uint32_t         _rateRefillMs;
     SourceType       _source;
 
+    UploadStatus     _status;
+    RetryPolicy      _retryPolicy;
+    uint16_t         _retryTokens;
+
 };
 
 #endif